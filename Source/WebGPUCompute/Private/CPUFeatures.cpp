@@ -0,0 +1,189 @@
+#include "CPUFeatures.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace
+{
+#if PLATFORM_CPU_X86_FAMILY
+	//Registers as { eax, ebx, ecx, edx }
+	void CPUID(uint32 Leaf, uint32 SubLeaf, uint32 Regs[4])
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		int Info[4];
+		__cpuidex(Info, (int)Leaf, (int)SubLeaf);
+		for (int32 i = 0; i < 4; i++)
+		{
+			Regs[i] = (uint32)Info[i];
+		}
+#else
+		__cpuid_count(Leaf, SubLeaf, Regs[0], Regs[1], Regs[2], Regs[3]);
+#endif
+	}
+
+	//Only valid once CPUID.1:ECX.OSXSAVE is set
+	uint64 ReadXCR0()
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		return _xgetbv(0);
+#else
+		uint32 Low = 0;
+		uint32 High = 0;
+		__asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+		return ((uint64)High << 32) | Low;
+#endif
+	}
+#endif
+}
+
+FCPUFeatures FCPUFeatures::Detect()
+{
+	FCPUFeatures Features;
+
+#if PLATFORM_CPU_X86_FAMILY
+	uint32 Regs[4];
+	CPUID(0, 0, Regs);
+	const uint32 MaxLeaf = Regs[0];
+
+	CPUID(1, 0, Regs);
+	const uint32 Leaf1ECX = Regs[2];
+	const uint32 Leaf1EDX = Regs[3];
+
+	Features.bSSE2 = (Leaf1EDX & (1u << 26)) != 0;
+	Features.bSSE42 = (Leaf1ECX & (1u << 20)) != 0;
+
+	//XCR0 bit 1 = XMM, 2 = YMM, 5-7 = opmask / ZMM0-15 upper halves / ZMM16-31
+	const bool bOSXSAVE = (Leaf1ECX & (1u << 27)) != 0;
+	const uint64 XCR0 = bOSXSAVE ? ReadXCR0() : 0;
+	Features.bOSSavesYMM = (XCR0 & 0x6) == 0x6;
+	Features.bOSSavesZMM = Features.bOSSavesYMM && (XCR0 & 0xe0) == 0xe0;
+
+	Features.bAVX = Features.bOSSavesYMM && (Leaf1ECX & (1u << 28)) != 0;
+	Features.bFMA = Features.bAVX && (Leaf1ECX & (1u << 12)) != 0;
+
+	if (MaxLeaf >= 7)
+	{
+		CPUID(7, 0, Regs);
+		const uint32 Leaf7EBX = Regs[1];
+		Features.bAVX2 = Features.bAVX && (Leaf7EBX & (1u << 5)) != 0;
+		Features.bAVX512F = Features.bOSSavesZMM && (Leaf7EBX & (1u << 16)) != 0;
+	}
+
+	//Vendor string is ebx, edx, ecx of leaf 0
+	CPUID(0, 0, Regs);
+	ANSICHAR VendorChars[13] = {};
+	FMemory::Memcpy(VendorChars + 0, &Regs[1], 4);
+	FMemory::Memcpy(VendorChars + 4, &Regs[3], 4);
+	FMemory::Memcpy(VendorChars + 8, &Regs[2], 4);
+	Features.Vendor = ANSI_TO_TCHAR(VendorChars);
+
+	//Intel reports caches in leaf 4, AMD the same layout in 0x8000001D when topology extensions are set
+	uint32 CacheLeaf = 0;
+	if (Features.Vendor == TEXT("GenuineIntel") && MaxLeaf >= 4)
+	{
+		CacheLeaf = 4;
+	}
+	else
+	{
+		CPUID(0x80000000, 0, Regs);
+		if (Regs[0] >= 0x8000001D)
+		{
+			CPUID(0x80000001, 0, Regs);
+			if (Regs[2] & (1u << 22))
+			{
+				CacheLeaf = 0x8000001D;
+			}
+		}
+	}
+
+	for (uint32 SubLeaf = 0; CacheLeaf != 0 && SubLeaf < 16; ++SubLeaf)
+	{
+		CPUID(CacheLeaf, SubLeaf, Regs);
+
+		//eax[4:0] type (0 = no more caches, 1 data, 2 instruction, 3 unified), eax[7:5] level, eax[25:14] sharing - 1
+		//ebx[11:0] line size - 1, ebx[21:12] partitions - 1, ebx[31:22] ways - 1, ecx sets - 1
+		const uint32 Type = Regs[0] & 0x1f;
+		if (Type == 0)
+		{
+			break;
+		}
+
+		FCPUCacheInfo Cache;
+		Cache.Level = (Regs[0] >> 5) & 0x7;
+		Cache.bData = Type != 2;
+		Cache.bInstruction = Type != 1;
+		Cache.LineSize = (Regs[1] & 0xfff) + 1;
+		Cache.Ways = ((Regs[1] >> 22) & 0x3ff) + 1;
+		Cache.SharedBy = ((Regs[0] >> 14) & 0xfff) + 1;
+		const uint32 Partitions = ((Regs[1] >> 12) & 0x3ff) + 1;
+		const uint32 Sets = Regs[2] + 1;
+		Cache.SizeBytes = Cache.Ways * Partitions * Cache.LineSize * Sets;
+		Features.Caches.Add(Cache);
+	}
+#endif
+
+	return Features;
+}
+
+const FCPUFeatures& FCPUFeatures::Get()
+{
+	static const FCPUFeatures Features = Detect();
+	return Features;
+}
+
+uint32 FCPUFeatures::GetCacheSize(int32 Level) const
+{
+	for (const FCPUCacheInfo& Cache : Caches)
+	{
+		if (Cache.Level == Level && Cache.bData)
+		{
+			return Cache.SizeBytes;
+		}
+	}
+	return 0;
+}
+
+ECPUSimdLevel FCPUFeatures::GetBestSimdLevel() const
+{
+	if (bAVX512F && bAVX2 && bFMA)
+	{
+		return ECPUSimdLevel::AVX512F;
+	}
+	if (bAVX2 && bFMA)
+	{
+		return ECPUSimdLevel::AVX2_FMA;
+	}
+	if (bAVX)
+	{
+		return ECPUSimdLevel::AVX;
+	}
+	if (bSSE42)
+	{
+		return ECPUSimdLevel::SSE42;
+	}
+	return ECPUSimdLevel::Scalar;
+}
+
+const TCHAR* FCPUFeatures::GetSimdLevelName(ECPUSimdLevel Level)
+{
+	switch (Level)
+	{
+	case ECPUSimdLevel::SSE42: return TEXT("SSE4.2");
+	case ECPUSimdLevel::AVX: return TEXT("AVX");
+	case ECPUSimdLevel::AVX2_FMA: return TEXT("AVX2+FMA");
+	case ECPUSimdLevel::AVX512F: return TEXT("AVX-512F");
+	default: return TEXT("Scalar");
+	}
+}
+
+FString FCPUFeatures::ToString() const
+{
+	return FString::Printf(TEXT("SSE2 %d, SSE4.2 %d, AVX %d, AVX2 %d, FMA %d, AVX-512F %d (OS YMM %d, ZMM %d), best: %s"),
+		bSSE2, bSSE42, bAVX, bAVX2, bFMA, bAVX512F, bOSSavesYMM, bOSSavesZMM, GetSimdLevelName(GetBestSimdLevel()));
+}
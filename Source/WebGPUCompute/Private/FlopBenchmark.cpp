@@ -1,26 +1,669 @@
 #include "FlopBenchmark.h"
+#include "BenchmarkStats.h"
 
-// gpu_flops_benchmark.cpp
+// CPU side, the GPU counterpart is FWebGPUBenchmark::BenchmarkFlops
 #include <chrono>
 #include <vector>
 #include <cmath>
 #include <immintrin.h>
 #include <thread>
-#include <future>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <random>
+#include <algorithm>
+#include <utility>
+
+#if PLATFORM_WINDOWS
+#include <windows.h>
+#endif
 
 #include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
 #include "GenericPlatform/GenericPlatformMisc.h"
 #include "Misc/OutputDeviceDebug.h"
 #include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
 #include "Logging/LogMacros.h"
 #include "Logging/LogVerbosity.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogFlopBenchmark, Log, All);
 
+namespace
+{
+	//Logical processors grouped by physical core, only the first 64 (one affinity mask / processor group).
+	//Empty if the platform doesn't expose its topology.
+	std::vector<std::vector<int32>> GetPhysicalCores()
+	{
+		std::vector<std::vector<int32>> Cores;
+
 #if PLATFORM_WINDOWS
-#include <windows.h>
+		DWORD Length = 0;
+		GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &Length);
+		std::vector<uint8> Buffer(Length);
+		if (Length == 0 || !GetLogicalProcessorInformationEx(RelationProcessorCore, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)Buffer.data(), &Length))
+		{
+			return Cores;
+		}
+
+		for (DWORD Offset = 0; Offset < Length;)
+		{
+			const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* Info = (const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(Buffer.data() + Offset);
+			Offset += Info->Size;
+
+			std::vector<int32> Core;
+			for (WORD Group = 0; Group < Info->Processor.GroupCount; ++Group)
+			{
+				if (Info->Processor.GroupMask[Group].Group != 0)
+				{
+					continue;
+				}
+				for (int32 Bit = 0; Bit < 64; ++Bit)
+				{
+					if (Info->Processor.GroupMask[Group].Mask & (1ull << Bit))
+					{
+						Core.push_back(Bit);
+					}
+				}
+			}
+			if (!Core.empty())
+			{
+				Cores.push_back(Core);
+			}
+		}
+#elif PLATFORM_LINUX
+		//Siblings share physical_package_id and core_id, offline cpus have no topology directory
+		std::vector<int64> CoreKeys;
+		for (int32 Cpu = 0; Cpu < 64; ++Cpu)
+		{
+			const FString Dir = FString::Printf(TEXT("/sys/devices/system/cpu/cpu%d/topology/"), Cpu);
+			FString CoreId;
+			FString PackageId;
+			if (!FFileHelper::LoadFileToString(CoreId, *(Dir + TEXT("core_id"))) || !FFileHelper::LoadFileToString(PackageId, *(Dir + TEXT("physical_package_id"))))
+			{
+				continue;
+			}
+
+			const int64 Key = ((int64)FCString::Atoi(*PackageId) << 32) | (uint32)FCString::Atoi(*CoreId);
+			const auto Found = std::find(CoreKeys.begin(), CoreKeys.end(), Key);
+			if (Found == CoreKeys.end())
+			{
+				CoreKeys.push_back(Key);
+				Cores.push_back({ Cpu });
+			}
+			else
+			{
+				Cores[Found - CoreKeys.begin()].push_back(Cpu);
+			}
+		}
 #endif
 
+		return Cores;
+	}
+}
+
+/**
+* Workers for the CPU benchmarks, spawned once and parked on a condition variable between runs so
+* thread creation never lands inside a timing. With bPinned, workers fill one logical processor per
+* physical core before any SMT sibling, so the first NumberOfCores threads never share a core.
+*/
+class FBenchmarkThreadPool
+{
+public:
+	FBenchmarkThreadPool(int32 NumThreads, bool bInPinned)
+		: bPinned(bInPinned)
+		, Finished(NumThreads)
+	{
+		if (bPinned)
+		{
+			BuildPinOrder(NumThreads);
+		}
+
+		for (int32 i = 0; i < NumThreads; ++i)
+		{
+			Threads.emplace_back([this, i]() { WorkerLoop(i); });
+		}
+	}
+
+	~FBenchmarkThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			bExit = true;
+		}
+		WakeUp.notify_all();
+
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+	}
+
+	int32 Num() const { return (int32)Threads.size(); }
+	bool IsPinned() const { return bPinned; }
+
+	//Runs Work(ThreadIndex) on the first ThreadCount workers and times from releasing them to the last
+	//one finishing. Workers are woken and spinning on the start flag before the clock starts.
+	double Time(int32 ThreadCount, TFunctionRef<void(int32)> InWork)
+	{
+		check(ThreadCount > 0 && ThreadCount <= Num());
+
+		NumReady.store(0);
+		NumDone.store(0);
+		bGo.store(false);
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Work = &InWork;
+			ActiveCount = ThreadCount;
+			++Generation;
+		}
+		WakeUp.notify_all();
+
+		while (NumReady.load() < ThreadCount)
+		{
+			std::this_thread::yield();
+		}
+
+		auto Start = std::chrono::steady_clock::now();
+		bGo.store(true, std::memory_order_release);
+
+		//Sleep rather than spin so the calling thread doesn't steal a core from the workers
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			AllDone.wait(Lock, [this, ThreadCount]() { return NumDone.load() == ThreadCount; });
+		}
+
+		auto End = Start;
+		for (int32 i = 0; i < ThreadCount; ++i)
+		{
+			End = FMath::Max(End, Finished[i]);
+		}
+		return std::chrono::duration<double>(End - Start).count();
+	}
+
+private:
+	//Round robin over the physical cores: sibling 0 of every core, then sibling 1, ... Falls back to
+	//worker i on logical processor i when the topology is unknown.
+	void BuildPinOrder(int32 NumThreads)
+	{
+		const std::vector<std::vector<int32>> Cores = GetPhysicalCores();
+
+		FString Mapping;
+		for (size_t Sibling = 0; (int32)PinOrder.size() < NumThreads; ++Sibling)
+		{
+			bool bAny = false;
+			for (size_t Core = 0; Core < Cores.size() && (int32)PinOrder.size() < NumThreads; ++Core)
+			{
+				if (Sibling < Cores[Core].size())
+				{
+					Mapping += FString::Printf(TEXT(" %d->%d(core %d)"), (int32)PinOrder.size(), Cores[Core][Sibling], (int32)Core);
+					PinOrder.push_back(Cores[Core][Sibling]);
+					bAny = true;
+				}
+			}
+			if (!bAny)
+			{
+				break;
+			}
+		}
+
+		if (PinOrder.empty())
+		{
+			UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Pool] Core topology unavailable, worker i pinned to logical processor i"));
+			for (int32 i = 0; i < NumThreads; ++i)
+			{
+				PinOrder.push_back(i);
+			}
+			return;
+		}
+
+		//More workers than pinnable processors leaves the rest unpinned
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Pool] %d physical cores, worker->logical processor:%s"), (int32)Cores.size(), *Mapping);
+	}
+
+	void WorkerLoop(int32 Index)
+	{
+		if (bPinned && Index < (int32)PinOrder.size() && PinOrder[Index] < 64)
+		{
+			FPlatformProcess::SetThreadAffinityMask(1ull << PinOrder[Index]);
+		}
+
+		uint64 SeenGeneration = 0;
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> Lock(Mutex);
+				WakeUp.wait(Lock, [this, Index, SeenGeneration]() { return bExit || (Generation != SeenGeneration && Index < ActiveCount); });
+				if (bExit)
+				{
+					return;
+				}
+				SeenGeneration = Generation;
+			}
+
+			NumReady.fetch_add(1);
+			while (!bGo.load(std::memory_order_acquire))
+			{
+				std::this_thread::yield();
+			}
+
+			(*Work)(Index);
+			Finished[Index] = std::chrono::steady_clock::now();
+
+			if (NumDone.fetch_add(1) + 1 == ActiveCount)
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				AllDone.notify_one();
+			}
+		}
+	}
+
+	const bool bPinned;
+	std::vector<int32> PinOrder;
+	std::vector<std::thread> Threads;
+	std::vector<std::chrono::steady_clock::time_point> Finished;
+
+	//Job hand-off, guarded by Mutex
+	std::mutex Mutex;
+	std::condition_variable WakeUp;
+	std::condition_variable AllDone;
+	uint64 Generation = 0;
+	int32 ActiveCount = 0;
+	bool bExit = false;
+	TFunctionRef<void(int32)>* Work = nullptr;
+
+	std::atomic<int32> NumReady{ 0 };
+	std::atomic<int32> NumDone{ 0 };
+	std::atomic<bool> bGo{ false };
+};
+
+namespace
+{
+	//Warmup + repetitions around Run(Iterations), which returns seconds. InOutIterations comes back
+	//scaled so that a single run takes at least Settings.MinRepetitionSeconds.
+	FBenchmarkStats RunHarness(const FFlopBenchmark::FHarnessSettings& Settings, uint64& InOutIterations, TFunctionRef<double(uint64)> Run)
+	{
+		uint64 Iterations = FMath::Max<uint64>(InOutIterations, 1);
+
+		double Seconds = Run(Iterations);
+		while (Seconds < Settings.MinRepetitionSeconds)
+		{
+			const double Scale = FMath::Clamp(1.2 * Settings.MinRepetitionSeconds / FMath::Max(Seconds, 1e-9), 2.0, 100.0);
+			Iterations = (uint64)(Iterations * Scale);
+			Seconds = Run(Iterations);
+		}
+
+		for (int32 i = 1; i < Settings.WarmupRuns; ++i)
+		{
+			Run(Iterations);
+		}
+
+		TArray<double> Samples;
+		for (int32 i = 0; i < FMath::Max(Settings.Repetitions, 1); ++i)
+		{
+			Samples.Add(Run(Iterations));
+		}
+
+		InOutIterations = Iterations;
+		return FBenchmarkStats::Compute(Samples, Settings.bRejectOutliers);
+	}
+
+	//One node per cache line so every load in the chase touches a new line
+	struct alignas(64) FChaseNode
+	{
+		FChaseNode* Next;
+		uint8 Pad[64 - sizeof(FChaseNode*)];
+	};
+
+	//Links Nodes[0, Num) into a single cycle in random order, so neither the prefetcher nor
+	//out-of-order execution can run ahead of the dependent loads
+	FChaseNode* BuildChase(FChaseNode* Nodes, int64 Num, std::vector<uint32>& Order)
+	{
+		Order.resize(Num);
+		for (int64 i = 0; i < Num; ++i)
+		{
+			Order[i] = (uint32)i;
+		}
+
+		std::mt19937_64 Random(0x5eed);
+		std::shuffle(Order.begin(), Order.end(), Random);
+
+		for (int64 i = 0; i < Num; ++i)
+		{
+			Nodes[Order[i]].Next = &Nodes[Order[(i + 1) % Num]];
+		}
+		return &Nodes[Order[0]];
+	}
+
+	//Groups x 8 dependent loads
+	FORCENOINLINE FChaseNode* Chase(FChaseNode* Node, uint64 Groups)
+	{
+		for (uint64 i = 0; i < Groups; ++i)
+		{
+			Node = Node->Next; Node = Node->Next; Node = Node->Next; Node = Node->Next;
+			Node = Node->Next; Node = Node->Next; Node = Node->Next; Node = Node->Next;
+		}
+		return Node;
+	}
+
+	//Runs above this spread aren't worth making decisions on
+	constexpr double UnstableCV = 0.05;
+
+	enum class EStreamKernel
+	{
+		Copy,	// a = b
+		Scale,	// a = s * b
+		Add,	// a = b + c
+		Triad,	// a = b + s * c
+	};
+
+	//Two doubles per store, Begin / End are multiples of 8 so every slice starts on a cache line
+	template<EStreamKernel Kernel, bool bNonTemporal>
+	void StreamSlice(double* A, const double* B, const double* C, double Scalar, int64 Begin, int64 End)
+	{
+		const __m128d S = _mm_set1_pd(Scalar);
+		for (int64 i = Begin; i < End; i += 2)
+		{
+			__m128d Value;
+			switch (Kernel)
+			{
+			case EStreamKernel::Copy:
+				Value = _mm_load_pd(B + i);
+				break;
+			case EStreamKernel::Scale:
+				Value = _mm_mul_pd(S, _mm_load_pd(B + i));
+				break;
+			case EStreamKernel::Add:
+				Value = _mm_add_pd(_mm_load_pd(B + i), _mm_load_pd(C + i));
+				break;
+			default:
+				Value = _mm_add_pd(_mm_load_pd(B + i), _mm_mul_pd(S, _mm_load_pd(C + i)));
+				break;
+			}
+
+			if (bNonTemporal)
+			{
+				_mm_stream_pd(A + i, Value);
+			}
+			else
+			{
+				_mm_store_pd(A + i, Value);
+			}
+		}
+
+		if (bNonTemporal)
+		{
+			_mm_sfence();
+		}
+	}
+
+	template<EStreamKernel Kernel>
+	void StreamSlice(bool bNonTemporal, double* A, const double* B, const double* C, double Scalar, int64 Begin, int64 End)
+	{
+		if (bNonTemporal)
+		{
+			StreamSlice<Kernel, true>(A, B, C, Scalar, Begin, End);
+		}
+		else
+		{
+			StreamSlice<Kernel, false>(A, B, C, Scalar, Begin, End);
+		}
+	}
+
+	//Runs Reps passes of Kernel over [0, Num) split into 8 element aligned slices, returns seconds. At most
+	//one thread per 8 elements so every thread gets a slice, OutProcessed is the element count covered.
+	double RunStream(FBenchmarkThreadPool& Pool, EStreamKernel Kernel, bool bNonTemporal, int32 ThreadCount, uint64 Reps, double* A, const double* B, const double* C, int64 Num, int64& OutProcessed)
+	{
+		const int32 ActiveThreads = (int32)FMath::Clamp<int64>(Num / 8, 1, ThreadCount);
+		const int64 SliceSize = Align(FMath::DivideAndRoundUp<int64>(Num, ActiveThreads), (int64)8);
+
+		OutProcessed = 0;
+		for (int32 t = 0; t < ActiveThreads; ++t)
+		{
+			const int64 Begin = FMath::Min(Num, t * SliceSize);
+			OutProcessed += FMath::Min(Num, Begin + SliceSize) - Begin;
+		}
+
+		return Pool.Time(ActiveThreads, [=](int32 t)
+		{
+			const int64 Begin = FMath::Min(Num, t * SliceSize);
+			const int64 End = FMath::Min(Num, Begin + SliceSize);
+			for (uint64 r = 0; r < Reps; ++r)
+			{
+				switch (Kernel)
+				{
+				case EStreamKernel::Copy:
+					StreamSlice<EStreamKernel::Copy>(bNonTemporal, A, B, C, 3.0, Begin, End);
+					break;
+				case EStreamKernel::Scale:
+					StreamSlice<EStreamKernel::Scale>(bNonTemporal, A, B, C, 3.0, Begin, End);
+					break;
+				case EStreamKernel::Add:
+					StreamSlice<EStreamKernel::Add>(bNonTemporal, A, B, C, 3.0, Begin, End);
+					break;
+				default:
+					StreamSlice<EStreamKernel::Triad>(bNonTemporal, A, B, C, 3.0, Begin, End);
+					break;
+				}
+			}
+		});
+	}
+
+	//Vector ops per instruction set, each compiled for its own target so the rest of the file stays
+	//baseline and nothing wider than the cpu supports is ever executed. SSE and AVX have no FMA, so
+	//MulAdd is a separate mul + add there, the same 2 FLOPs per lane either way.
+	struct FScalarOps
+	{
+		using Type = float;
+		static constexpr int32 Width = 1;
+
+		static FORCEINLINE Type Set1(float Value) { return Value; }
+		static FORCEINLINE Type MulAdd(Type A, Type B, Type C) { return A * B + C; }
+		static FORCEINLINE float Sum(Type A) { return A; }
+	};
+
+	struct FSSEOps
+	{
+		using Type = __m128;
+		static constexpr int32 Width = 4;
+
+		static CPU_TARGET_SSE42 FORCEINLINE Type Set1(float Value) { return _mm_set1_ps(Value); }
+		static CPU_TARGET_SSE42 FORCEINLINE Type MulAdd(Type A, Type B, Type C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+		static CPU_TARGET_SSE42 FORCEINLINE float Sum(Type A)
+		{
+			alignas(16) float Lanes[4];
+			_mm_store_ps(Lanes, A);
+			return Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+		}
+	};
+
+	struct FAVXOps
+	{
+		using Type = __m256;
+		static constexpr int32 Width = 8;
+
+		static CPU_TARGET_AVX FORCEINLINE Type Set1(float Value) { return _mm256_set1_ps(Value); }
+		static CPU_TARGET_AVX FORCEINLINE Type MulAdd(Type A, Type B, Type C) { return _mm256_add_ps(_mm256_mul_ps(A, B), C); }
+		static CPU_TARGET_AVX FORCEINLINE float Sum(Type A)
+		{
+			alignas(32) float Lanes[8];
+			_mm256_store_ps(Lanes, A);
+			float Total = 0.0f;
+			for (int32 i = 0; i < 8; ++i)
+			{
+				Total += Lanes[i];
+			}
+			return Total;
+		}
+	};
+
+	struct FAVX2Ops
+	{
+		using Type = __m256;
+		static constexpr int32 Width = 8;
+
+		static CPU_TARGET_AVX2_FMA FORCEINLINE Type Set1(float Value) { return _mm256_set1_ps(Value); }
+		static CPU_TARGET_AVX2_FMA FORCEINLINE Type MulAdd(Type A, Type B, Type C) { return _mm256_fmadd_ps(A, B, C); }
+		static CPU_TARGET_AVX2_FMA FORCEINLINE float Sum(Type A)
+		{
+			alignas(32) float Lanes[8];
+			_mm256_store_ps(Lanes, A);
+			float Total = 0.0f;
+			for (int32 i = 0; i < 8; ++i)
+			{
+				Total += Lanes[i];
+			}
+			return Total;
+		}
+	};
+
+	struct FAVX512Ops
+	{
+		using Type = __m512;
+		static constexpr int32 Width = 16;
+
+		static CPU_TARGET_AVX512F FORCEINLINE Type Set1(float Value) { return _mm512_set1_ps(Value); }
+		static CPU_TARGET_AVX512F FORCEINLINE Type MulAdd(Type A, Type B, Type C) { return _mm512_fmadd_ps(A, B, C); }
+		static CPU_TARGET_AVX512F FORCEINLINE float Sum(Type A)
+		{
+			alignas(64) float Lanes[16];
+			_mm512_store_ps(Lanes, A);
+			float Total = 0.0f;
+			for (int32 i = 0; i < 16; ++i)
+			{
+				Total += Lanes[i];
+			}
+			return Total;
+		}
+	};
+
+	//Stamps out Name<NumAcc>(Iterations) for one Ops/target pair: NumAcc independent multiply-add chains,
+	//unrolled at compile time through an index sequence. Enough chains to cover latency x issue ports keeps
+	//the FMA units saturated (peak throughput), a single chain measures the dependent-op latency instead.
+	//This has to be a macro rather than a template over Ops because GCC/Clang won't inline target specific
+	//intrinsics into a function without the same target attribute. Acc = Acc * 0.999999 + 1e-6 converges
+	//on 1 from any start, so values never drift into denormals or infinity however long the run. Starting
+	//at 1 would be a fixed point the compiler can fold the whole loop away on, hence 2 + k.
+#define DEFINE_FLOPS_KERNEL(Name, Target, Ops) \
+	template<std::size_t... I> \
+	Target FORCEINLINE void Name##Step(Ops::Type (&Acc)[sizeof...(I)], Ops::Type Mul, Ops::Type Add, std::index_sequence<I...>) \
+	{ \
+		((Acc[I] = Ops::MulAdd(Acc[I], Mul, Add)), ...); \
+	} \
+	template<int32 NumAcc> \
+	Target float Name(uint64 Iterations) \
+	{ \
+		Ops::Type Acc[NumAcc]; \
+		for (int32 k = 0; k < NumAcc; ++k) \
+		{ \
+			Acc[k] = Ops::Set1(2.0f + k); \
+		} \
+		const Ops::Type Mul = Ops::Set1(0.999999f); \
+		const Ops::Type Add = Ops::Set1(1e-6f); \
+		for (uint64 i = 0; i < Iterations; ++i) \
+		{ \
+			Name##Step(Acc, Mul, Add, std::make_index_sequence<NumAcc>()); \
+		} \
+		float Total = 0.0f; \
+		for (int32 k = 0; k < NumAcc; ++k) \
+		{ \
+			Total += Ops::Sum(Acc[k]); \
+		} \
+		return Total; \
+	}
+
+	DEFINE_FLOPS_KERNEL(FlopsKernelScalar, , FScalarOps)
+	DEFINE_FLOPS_KERNEL(FlopsKernelSSE, CPU_TARGET_SSE42, FSSEOps)
+	DEFINE_FLOPS_KERNEL(FlopsKernelAVX, CPU_TARGET_AVX, FAVXOps)
+	DEFINE_FLOPS_KERNEL(FlopsKernelAVX2, CPU_TARGET_AVX2_FMA, FAVX2Ops)
+	DEFINE_FLOPS_KERNEL(FlopsKernelAVX512, CPU_TARGET_AVX512F, FAVX512Ops)
+
+#undef DEFINE_FLOPS_KERNEL
+
+	struct FFlopsKernel
+	{
+		float (*Run)(uint64 Iterations);
+		int32 Width;
+		int32 NumAcc;
+		const TCHAR* Name;
+	};
+
+	//Throughput accumulator counts fit the register file with room for Mul / Add: 16 xmm/ymm, 32 zmm.
+	//4-5 cycle FMA latency on two ports needs 8-10 chains, AVX-512 gets more since it has the registers.
+	FFlopsKernel GetFlopsKernel(ECPUSimdLevel Level, bool bLatency)
+	{
+		switch (Level)
+		{
+		case ECPUSimdLevel::SSE42:
+			return bLatency ? FFlopsKernel{ &FlopsKernelSSE<1>, 4, 1, TEXT("SSE") } : FFlopsKernel{ &FlopsKernelSSE<10>, 4, 10, TEXT("SSE") };
+		case ECPUSimdLevel::AVX:
+			return bLatency ? FFlopsKernel{ &FlopsKernelAVX<1>, 8, 1, TEXT("AVX") } : FFlopsKernel{ &FlopsKernelAVX<10>, 8, 10, TEXT("AVX") };
+		case ECPUSimdLevel::AVX2_FMA:
+			return bLatency ? FFlopsKernel{ &FlopsKernelAVX2<1>, 8, 1, TEXT("AVX2") } : FFlopsKernel{ &FlopsKernelAVX2<12>, 8, 12, TEXT("AVX2") };
+		case ECPUSimdLevel::AVX512F:
+			return bLatency ? FFlopsKernel{ &FlopsKernelAVX512<1>, 16, 1, TEXT("AVX-512") } : FFlopsKernel{ &FlopsKernelAVX512<24>, 16, 24, TEXT("AVX-512") };
+		default:
+			return bLatency ? FFlopsKernel{ &FlopsKernelScalar<1>, 1, 1, TEXT("Scalar") } : FFlopsKernel{ &FlopsKernelScalar<10>, 1, 10, TEXT("Scalar") };
+		}
+	}
+
+	//Times Kernel on ThreadCount pool workers, Iterations comes back autoscaled by the harness
+	FBenchmarkStats MeasureFlops(const FFlopBenchmark::FHarnessSettings& Settings, FBenchmarkThreadPool& Pool, const FFlopsKernel& Kernel, int32 ThreadCount, uint64& Iterations, float& OutSink)
+	{
+		std::vector<float> Sinks(ThreadCount, 0.0f);
+		const FBenchmarkStats Stats = RunHarness(Settings, Iterations, [&](uint64 RunIterations)
+		{
+			return Pool.Time(ThreadCount, [&](int32 Thread)
+			{
+				Sinks[Thread] += Kernel.Run(RunIterations);
+			});
+		});
+
+		for (float Sink : Sinks)
+		{
+			OutSink += Sink;
+		}
+		return Stats;
+	}
+
+	//Runs Kernel on ThreadCount threads, the caller makes sure its instruction set is supported
+	void RunFlopsBenchmark(const FFlopBenchmark::FHarnessSettings& Settings, FBenchmarkThreadPool& Pool, const FFlopsKernel& Kernel, bool bLatency, int32 ThreadCount, uint64 Iterations)
+	{
+		float Sink = 0.0f;
+		const FBenchmarkStats Stats = MeasureFlops(Settings, Pool, Kernel, ThreadCount, Iterations, Sink);
+		volatile float totalSink = Sink;
+
+		double Flops = 2.0 * Kernel.Width * Kernel.NumAcc * Iterations * ThreadCount; // mul-add x accumulators x vector width
+
+		const TCHAR* Mode = bLatency ? TEXT("latency") : TEXT("throughput");
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU %s MT] Threads: %d, Mode: %s, Accumulators: %d, Iterations: %llu"), Kernel.Name, ThreadCount, Mode, Kernel.NumAcc, Iterations);
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU %s MT] Elapsed Time: %s"), Kernel.Name, *Stats.ToString(1e3, TEXT(" ms")));
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU %s MT] Total FLOPs: %.0f"), Kernel.Name, Flops);
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU %s MT] FLOPs/s: %.2f GFLOPs (median), %.2f GFLOPs (best)"), Kernel.Name, (Flops / Stats.Median()) / 1e9, (Flops / Stats.Min) / 1e9);
+		if (bLatency)
+		{
+			UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU %s MT] Dependent multiply-add: %.3f ns"), Kernel.Name, Stats.Median() * 1e9 / Iterations);
+		}
+		if (Stats.CV > UnstableCV)
+		{
+			UE_LOG(LogFlopBenchmark, Warning, TEXT("[CPU %s MT] Timings vary by %.1f%% between repetitions, results are noisy"), Kernel.Name, Stats.CV * 100.0);
+		}
+		UE_LOG(LogFlopBenchmark, Verbose, TEXT("[CPU %s MT] Result checksum: %f"), Kernel.Name, (float)totalSink);
+	}
+}
+
+FFlopBenchmark::FFlopBenchmark() = default;
+FFlopBenchmark::~FFlopBenchmark() = default;
+
+FBenchmarkThreadPool& FFlopBenchmark::GetPool(int32 ThreadCount)
+{
+	if (!Pool || Pool->Num() < ThreadCount || Pool->IsPinned() != Harness.bPinThreads)
+	{
+		Pool.Reset();
+		Pool = MakeUnique<FBenchmarkThreadPool>(FMath::Max<int32>(ThreadCount, std::thread::hardware_concurrency()), Harness.bPinThreads);
+	}
+	return *Pool;
+}
 
 float FFlopBenchmark::GetCPUFrequencyMHz()
 {
@@ -46,24 +689,26 @@ float FFlopBenchmark::GetCPUFrequencyMHz()
 
 bool FFlopBenchmark::SupportsAVX2() 
 {
-#if PLATFORM_ENABLE_VECTORINTRINSICS
-	return true;
-#else
-	return false;
-#endif
+	return FCPUFeatures::Get().Supports(ECPUSimdLevel::AVX2_FMA);
 }
 
 bool FFlopBenchmark::SupportsAVX512() 
 {
-#if PLATFORM_ENABLE_VECTORINTRINSICS
-	return true;
-#else
-	return false;
-#endif
+	return FCPUFeatures::Get().Supports(ECPUSimdLevel::AVX512F);
 }
 
 void FFlopBenchmark::PrintCPUIDInfo()
 {
+	const FCPUFeatures& Features = FCPUFeatures::Get();
+	UE_LOG(LogFlopBenchmark, Log, TEXT("Vendor: %s"), *Features.Vendor);
+	UE_LOG(LogFlopBenchmark, Log, TEXT("Usable instruction sets: %s"), *Features.ToString());
+	for (const FCPUCacheInfo& Cache : Features.Caches)
+	{
+		UE_LOG(LogFlopBenchmark, Log, TEXT("L%d %s cache: %u KB, %u-way, %u B lines, shared by %u logical processors"),
+			Cache.Level, Cache.bData ? (Cache.bInstruction ? TEXT("unified") : TEXT("data")) : TEXT("instruction"),
+			Cache.SizeBytes / 1024, Cache.Ways, Cache.LineSize, Cache.SharedBy);
+	}
+
 	//from https://gist.github.com/boxmein/7d8e5fae7febafc5851e
 #if PLATFORM_WINDOWS
 	int cpuinfo[4];
@@ -106,154 +751,274 @@ void FFlopBenchmark::PrintCPUIDInfo()
 #endif
 }
 
-void FFlopBenchmark::BenchmarkCPUScalar(int32 ThreadCount, uint64 IterationsPerThread)
+void FFlopBenchmark::BenchmarkCPUScalar(int32 ThreadCount, uint64 IterationsPerThread, bool bLatency)
 {
-	auto Start = std::chrono::high_resolution_clock::now();
+	ThreadCount = FMath::Max(ThreadCount, 1);
+	RunFlopsBenchmark(Harness, GetPool(ThreadCount), GetFlopsKernel(ECPUSimdLevel::Scalar, bLatency), bLatency, ThreadCount, IterationsPerThread);
+}
 
-	std::vector<std::future<double>> futures;
-	for (int32 t = 0; t < ThreadCount; ++t) 
+void FFlopBenchmark::BenchmarkAVX2(uint64 Iterations, bool bLatency)
+{
+	if (!SupportsAVX2())
 	{
-		futures.push_back(std::async(std::launch::async, [IterationsPerThread]() 
-		{
-			float a1 = 1.0f, b1 = 2.0f, c1 = 3.0f;
-			float a2 = 4.0f, b2 = 5.0f, c2 = 6.0f;
-			float a3 = 7.0f, b3 = 8.0f, c3 = 9.0f;
-			float a4 = 10.0f, b4 = 11.0f, c4 = 12.0f;
+		UE_LOG(LogFlopBenchmark, Warning, TEXT("[CPU AVX2 MT] AVX2+FMA not usable on this machine, falling back to %s"),
+			FCPUFeatures::GetSimdLevelName(FCPUFeatures::Get().GetBestSimdLevel()));
+		BenchmarkSIMD(Iterations, bLatency);
+		return;
+	}
 
-			for (uint64 j = 0; j < IterationsPerThread; ++j)
-			{
-				a1 = a1 * b1 + c1;
-				b1 = b1 * c1 + a1;
-				c1 = c1 * a1 + b1;
+	RunFlopsBenchmark(Harness, GetPool(std::thread::hardware_concurrency()), GetFlopsKernel(ECPUSimdLevel::AVX2_FMA, bLatency), bLatency, std::thread::hardware_concurrency(), Iterations);
+}
 
-				a2 = a2 * b2 + c2;
-				b2 = b2 * c2 + a2;
-				c2 = c2 * a2 + b2;
+void FFlopBenchmark::BenchmarkAVX512(uint64 Iterations, bool bLatency)
+{
+	if (!SupportsAVX512())
+	{
+		UE_LOG(LogFlopBenchmark, Warning, TEXT("[CPU AVX-512 MT] AVX-512F not usable on this machine, falling back to %s"),
+			FCPUFeatures::GetSimdLevelName(FCPUFeatures::Get().GetBestSimdLevel()));
+		BenchmarkSIMD(Iterations, bLatency);
+		return;
+	}
 
-				a3 = a3 * b3 + c3;
-				b3 = b3 * c3 + a3;
-				c3 = c3 * a3 + b3;
+	RunFlopsBenchmark(Harness, GetPool(std::thread::hardware_concurrency()), GetFlopsKernel(ECPUSimdLevel::AVX512F, bLatency), bLatency, std::thread::hardware_concurrency(), Iterations);
+}
 
-				a4 = a4 * b4 + c4;
-				b4 = b4 * c4 + a4;
-				c4 = c4 * a4 + b4;
-			}
+void FFlopBenchmark::BenchmarkSIMD(uint64 Iterations, bool bLatency)
+{
+	const ECPUSimdLevel Level = FCPUFeatures::Get().GetBestSimdLevel();
+	RunFlopsBenchmark(Harness, GetPool(std::thread::hardware_concurrency()), GetFlopsKernel(Level, bLatency), bLatency, std::thread::hardware_concurrency(), Iterations);
+}
 
-			volatile float sink = a1 + b1 + c1 + a2 + b2 + c2 + a3 + b3 + c3 + a4 + b4 + c4;
-			return static_cast<double>(sink); // placeholder to prevent optimization
-		}));
+void FFlopBenchmark::BenchmarkScaling(int32 MaxThreads, uint64 Iterations, bool bVector)
+{
+	if (MaxThreads <= 0)
+	{
+		MaxThreads = std::thread::hardware_concurrency();
 	}
 
-	for (auto& f : futures) f.get();
+	const FFlopsKernel Kernel = GetFlopsKernel(bVector ? FCPUFeatures::Get().GetBestSimdLevel() : ECPUSimdLevel::Scalar, false);
+	FBenchmarkThreadPool& Pool = GetPool(MaxThreads);
+
+	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Scaling] Kernel: %s, Cores: %d physical / %d logical, Pinned: %d"),
+		Kernel.Name, FPlatformMisc::NumberOfCores(), FPlatformMisc::NumberOfCoresIncludingHyperthreads(), Harness.bPinThreads);
+
+	//Weak scaling, every thread runs the full iteration count, so perfect scaling keeps GFLOPs linear
+	float Sink = 0.0f;
+	double SingleGFlops = 0.0;
+	int32 FirstInefficient = 0;
+	for (int32 ThreadCount = 1; ThreadCount <= MaxThreads; ++ThreadCount)
+	{
+		uint64 RunIterations = Iterations;
+		const FBenchmarkStats Stats = MeasureFlops(Harness, Pool, Kernel, ThreadCount, RunIterations, Sink);
+
+		const double GFlops = (2.0 * Kernel.Width * Kernel.NumAcc * RunIterations * ThreadCount / Stats.Median()) / 1e9;
+		if (ThreadCount == 1)
+		{
+			SingleGFlops = GFlops;
+		}
+
+		const double Speedup = GFlops / SingleGFlops;
+		const double Efficiency = Speedup / ThreadCount;
+		if (FirstInefficient == 0 && Efficiency < 0.85)
+		{
+			FirstInefficient = ThreadCount;
+		}
+
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Scaling] %3d threads: %8.2f GFLOPs, speedup %5.2fx, efficiency %3.0f%% (cv %.1f%%)"),
+			ThreadCount, GFlops, Speedup, Efficiency * 100.0, Stats.CV * 100.0);
+	}
 
-	auto End = std::chrono::high_resolution_clock::now();
-	double Seconds = std::chrono::duration<double>(End - Start).count();
-	double Flops = 24.0 * IterationsPerThread * ThreadCount;
-	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Scalar MT] Elapsed Time: %.6fs"), Seconds);
-	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Scalar MT] Total FLOPs: %.0f"), Flops);
-	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Scalar MT] FLOPs/s: %.2f GFLOPs"), (Flops / Seconds) / 1e9);
+	//Pinned workers fill every physical core before any SMT sibling, so a drop right after the physical
+	//core count is siblings sharing FMA units. Unpinned, the scheduler decides placement and an earlier
+	//drop may be two threads landing on one core rather than anything about the cores themselves.
+	if (FirstInefficient > 0)
+	{
+		const bool bPastPhysical = FirstInefficient > FPlatformMisc::NumberOfCores();
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Scaling] Efficiency falls below 85%% at %d threads%s"), FirstInefficient,
+			bPastPhysical ? TEXT(", past the physical core count (SMT siblings share execution units)") :
+			Harness.bPinThreads ? TEXT(", before the physical core count") : TEXT(", threads unpinned so SMT placement is up to the scheduler"));
+	}
+	UE_LOG(LogFlopBenchmark, Verbose, TEXT("[CPU Scaling] Result checksum: %f"), Sink);
 }
 
-void FFlopBenchmark::BenchmarkAVX2(uint64 Iterations)
+void FFlopBenchmark::BenchmarkLatency(uint64 MinBytes, uint64 MaxBytes)
 {
-	if (!SupportsAVX2()) return;
+	MinBytes = FMath::RoundUpToPowerOfTwo64(FMath::Max<uint64>(MinBytes, 4096));
+	MaxBytes = FMath::Max(MaxBytes, MinBytes);
 
-	auto Start = std::chrono::high_resolution_clock::now();
+	const int64 MaxNodes = (int64)(MaxBytes / sizeof(FChaseNode));
+	FChaseNode* Nodes = (FChaseNode*)FMemory::Malloc(MaxNodes * sizeof(FChaseNode), 4096);
+	std::vector<uint32> Order;
 
-	int32 ThreadCount = std::thread::hardware_concurrency();
-	std::vector<std::future<float>> futures;
+	//Powers of two plus the midpoints between them, caches are rarely a power of two these days.
+	//Past the TLB reach the numbers include page walks, as any pointer-heavy structure would see.
+	struct FLatencyPoint
+	{
+		uint64 Bytes;
+		double Ns;
+	};
+	TArray<FLatencyPoint> Curve;
 
-	for (int32 t = 0; t < ThreadCount; ++t)
+	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Latency] Random pointer chase, %llu KB to %llu KB"), MinBytes / 1024, MaxBytes / 1024);
+
+	FChaseNode* Sink = nullptr;
+	for (uint64 PowerOfTwo = MinBytes; PowerOfTwo <= MaxBytes; PowerOfTwo *= 2)
 	{
-		futures.push_back(std::async(std::launch::async, [Iterations]() -> float
+		for (uint64 Bytes : { PowerOfTwo, PowerOfTwo + PowerOfTwo / 2 })
+		{
+			if (Bytes > MaxBytes)
 			{
-				__m256 a = _mm256_set_ps(1, 2, 3, 4, 5, 6, 7, 8);
-				__m256 b = _mm256_add_ps(a, _mm256_set1_ps(1.0f));
-				__m256 c = _mm256_add_ps(b, _mm256_set1_ps(1.0f));
+				break;
+			}
 
-				for (uint64 i = 0; i < Iterations; ++i)
-				{
-					a = _mm256_fmadd_ps(a, b, c);
-					b = _mm256_fmadd_ps(b, c, a);
-					c = _mm256_fmadd_ps(c, a, b);
-				}
+			const int64 Num = (int64)(Bytes / sizeof(FChaseNode));
+			FChaseNode* Start = BuildChase(Nodes, Num, Order);
 
-				__m256 result = _mm256_add_ps(a, _mm256_add_ps(b, c));
-				float resultArray[8];
-				_mm256_storeu_ps(resultArray, result);
-				volatile float sink = 0.0f;
-				for (int i = 0; i < 8; ++i)
-				{
-					sink += resultArray[i];
-				}
-				return sink;
-			}));
+			uint64 Groups = FMath::Max<uint64>(Num / 8, 1024);
+			const FBenchmarkStats Stats = RunHarness(Harness, Groups, [&](uint64 RunGroups)
+			{
+				auto Begin = std::chrono::steady_clock::now();
+				Sink = Chase(Start, RunGroups);
+				return std::chrono::duration<double>(std::chrono::steady_clock::now() - Begin).count();
+			});
+
+			const double Ns = Stats.Median() * 1e9 / (Groups * 8);
+			Curve.Add({ Bytes, Ns });
+
+			UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Latency] %8llu KB: %6.2f ns per load (cv %.1f%%)"), Bytes / 1024, Ns, Stats.CV * 100.0);
+		}
 	}
 
-	float totalSink = 0.0f;
-	for (auto& f : futures)
+	FMemory::Free(Nodes);
+	UE_LOG(LogFlopBenchmark, Verbose, TEXT("[CPU Latency] Sink: %p"), (void*)Sink);
+
+	//Each capacity boundary shows up as a run of steps where latency climbs by more than 15%. The
+	//three steepest runs are L1 -> L2, L2 -> L3 and L3 -> DRAM, and the size right before each run is
+	//the last one that still fit. TLB misses and adjacent-line prefetch can add smaller bumps, which
+	//is why the steepest runs win rather than the first ones.
+	struct FRise
 	{
-		totalSink += f.get();
+		int32 Begin;
+		int32 End;
+		double Factor;
+	};
+	TArray<FRise> Rises;
+	for (int32 i = 1; i < Curve.Num(); ++i)
+	{
+		if (Curve[i].Ns < Curve[i - 1].Ns * 1.15)
+		{
+			continue;
+		}
+
+		if (Rises.Num() > 0 && Rises.Last().End == i - 1)
+		{
+			Rises.Last().End = i;
+		}
+		else
+		{
+			Rises.Add({ i - 1, i, 0.0 });
+		}
+		Rises.Last().Factor = Curve[i].Ns / Curve[Rises.Last().Begin].Ns;
 	}
 
-	auto End = std::chrono::high_resolution_clock::now();
-	double Seconds = std::chrono::duration<double>(End - Start).count();
-	double Flops = 6.0 * 8 * Iterations * ThreadCount;
+	Rises.Sort([](const FRise& A, const FRise& B) { return A.Factor > B.Factor; });
+	if (Rises.Num() > 3)
+	{
+		Rises.SetNum(3);
+	}
+	Rises.Sort([](const FRise& A, const FRise& B) { return A.Begin < B.Begin; });
 
-	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU AVX2 MT] Elapsed Time: %.6fs"), Seconds);
-	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU AVX2 MT] Total FLOPs: %.0f"), Flops);
-	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU AVX2 MT] FLOPs/s: %.2f GFLOPs"), (Flops / Seconds) / 1e9);
-	UE_LOG(LogFlopBenchmark, Verbose, TEXT("[CPU AVX2 MT] Result checksum: %f"), totalSink);
+	const FCPUFeatures& Features = FCPUFeatures::Get();
+	for (int32 Level = 1; Level <= Rises.Num(); ++Level)
+	{
+		const FLatencyPoint& Fit = Curve[Rises[Level - 1].Begin];
+		const uint64 ReportedBytes = Features.GetCacheSize(Level);
+
+		if (ReportedBytes == 0)
+		{
+			UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Latency] L%d: ~%llu KB at %.2f ns (no CPUID descriptor)"), Level, Fit.Bytes / 1024, Fit.Ns);
+			continue;
+		}
+
+		//Shared caches, inclusive hierarchies and the coarse size steps make anything within 2x a match
+		const double Ratio = (double)Fit.Bytes / ReportedBytes;
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Latency] L%d: ~%llu KB at %.2f ns, CPUID reports %llu KB%s"),
+			Level, Fit.Bytes / 1024, Fit.Ns, ReportedBytes / 1024, (Ratio < 0.5 || Ratio > 2.0) ? TEXT(" (mismatch)") : TEXT(""));
+	}
+
+	//The third boundary is L3 -> DRAM, without it the sweep never left the caches
+	if (Rises.Num() == 3)
+	{
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Latency] Memory: %.2f ns at %llu KB"), Curve.Last().Ns, Curve.Last().Bytes / 1024);
+	}
+	else
+	{
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Latency] Found %d of 3 cache boundaries, raise MaxBytes past the last level cache for memory latency"), Rises.Num());
+	}
 }
 
-void FFlopBenchmark::BenchmarkAVX512(uint64 Iterations)
+void FFlopBenchmark::BenchmarkBandwidth(int32 ThreadCount, uint64 MinBytes, uint64 MaxBytes, bool bNonTemporal)
 {
-	if (!SupportsAVX512()) return;
-
-	auto Start = std::chrono::high_resolution_clock::now();
+	ThreadCount = FMath::Max(ThreadCount, 1);
+	FBenchmarkThreadPool& Pool = GetPool(ThreadCount);
+	MinBytes = FMath::RoundUpToPowerOfTwo64(FMath::Max<uint64>(MinBytes, 4096));
+	MaxBytes = FMath::Max(MaxBytes, MinBytes);
 
-	int32 ThreadCount = std::thread::hardware_concurrency();
-	std::vector<std::future<float>> futures;
+	//Three arrays of MaxBytes / 3, allocated once and touched up front so page faults stay out of the timings
+	const int64 MaxNum = (int64)(MaxBytes / (3 * sizeof(double))) & ~(int64)7;
+	double* A = (double*)FMemory::Malloc(MaxNum * sizeof(double), 64);
+	double* B = (double*)FMemory::Malloc(MaxNum * sizeof(double), 64);
+	double* C = (double*)FMemory::Malloc(MaxNum * sizeof(double), 64);
+	for (int64 i = 0; i < MaxNum; ++i)
+	{
+		A[i] = 1.0;
+		B[i] = 2.0;
+		C[i] = 0.5;
+	}
 
-	for (int32 t = 0; t < ThreadCount; ++t)
+	struct FStreamCase
 	{
-		futures.push_back(std::async(std::launch::async, [Iterations]() -> float
-			{
-				__m512 a = _mm512_set_ps(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
-				__m512 b = _mm512_add_ps(a, _mm512_set1_ps(1.0f));
-				__m512 c = _mm512_add_ps(b, _mm512_set1_ps(1.0f));
+		EStreamKernel Kernel;
+		double BytesPerElement;
+	};
 
-				for (uint64 i = 0; i < Iterations; ++i)
-				{
-					a = _mm512_fmadd_ps(a, b, c);
-					b = _mm512_fmadd_ps(b, c, a);
-					c = _mm512_fmadd_ps(c, a, b);
-				}
+	//STREAM counting: one read per source array and one write, write-allocate traffic not included
+	const FStreamCase Cases[] = {
+		{ EStreamKernel::Copy, 2.0 * sizeof(double) },
+		{ EStreamKernel::Scale, 2.0 * sizeof(double) },
+		{ EStreamKernel::Add, 3.0 * sizeof(double) },
+		{ EStreamKernel::Triad, 3.0 * sizeof(double) },
+	};
 
-				__m512 result = _mm512_add_ps(a, _mm512_add_ps(b, c));
-				alignas(64) float resultArray[16];
-				_mm512_storeu_ps(resultArray, result);
-				volatile float sink = 0.0f;
-				for (int i = 0; i < 16; ++i)
-				{
-					sink += resultArray[i];
-				}
-				return sink;
-			}));
-	}
+	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Bandwidth MT] Threads: %d, Stores: %s"), ThreadCount, bNonTemporal ? TEXT("non-temporal") : TEXT("regular"));
 
-	float totalSink = 0.0f;
-	for (auto& f : futures)
+	for (uint64 WorkingSet = MinBytes; WorkingSet <= MaxBytes; WorkingSet *= 2)
 	{
-		totalSink += f.get();
-	}
+		const int64 Num = FMath::Min<int64>(MaxNum, FMath::Max<int64>((int64)(WorkingSet / (3 * sizeof(double))) & ~(int64)7, 8));
+
+		//Starting point of ~64 MB of traffic per repetition, the harness scales it up from there
+		const uint64 StartReps = FMath::Max<uint64>(64ull * 1024 * 1024 / (Num * 3 * sizeof(double)), 1);
+
+		double GBs[4];
+		double MaxCV = 0.0;
+		for (int32 k = 0; k < 4; ++k)
+		{
+			uint64 Reps = StartReps;
+			int64 Processed = 0;
+			const FBenchmarkStats Stats = RunHarness(Harness, Reps, [&](uint64 RunReps)
+			{
+				return RunStream(Pool, Cases[k].Kernel, bNonTemporal, ThreadCount, RunReps, A, B, C, Num, Processed);
+			});
+			GBs[k] = (Cases[k].BytesPerElement * Processed * Reps / Stats.Median()) / 1e9;
+			MaxCV = FMath::Max(MaxCV, Stats.CV);
+		}
 
-	auto End = std::chrono::high_resolution_clock::now();
-	double Seconds = std::chrono::duration<double>(End - Start).count();
-	double Flops = 6.0 * 16 * Iterations * ThreadCount; // 3 FMAs  2 FLOPs  16-wide vector
+		//Median of the repetitions, cv is the worst of the four kernels
+		UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU Bandwidth MT] %8llu KB: Copy %.1f GB/s, Scale %.1f GB/s, Add %.1f GB/s, Triad %.1f GB/s (cv %.1f%%)"),
+			(Num * 3 * sizeof(double)) / 1024, GBs[0], GBs[1], GBs[2], GBs[3], MaxCV * 100.0);
+	}
 
-	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU AVX-512 MT] Elapsed Time: %.6fs"), Seconds);
-	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU AVX-512 MT] Total FLOPs: %.0f"), Flops);
-	UE_LOG(LogFlopBenchmark, Log, TEXT("[CPU AVX-512 MT] FLOPs/s: %.2f GFLOPs"), (Flops / Seconds) / 1e9);
-	UE_LOG(LogFlopBenchmark, Verbose, TEXT("[CPU AVX-512 MT] Result checksum: %f"), totalSink);
-}
\ No newline at end of file
+	FMemory::Free(C);
+	FMemory::Free(B);
+	FMemory::Free(A);
+}
@@ -0,0 +1,1480 @@
+#include "WebGPUBenchmark.h"
+#include "BenchmarkStats.h"
+#include "WebGPUContext.h"
+#include "WebGPUKernel.h"
+#include "WebGPUScan.h"
+#include "WebGPURadixSort.h"
+#include "WebGPUGemm.h"
+#include "WebGPUNoise.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+#include "Math/Float16.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogWebGPUBenchmark, Log, All);
+
+namespace
+{
+	//Blocked three phase scan: chunk totals in parallel, serial scan of the totals, chunk scans in parallel
+	void ParallelExclusiveScan(const uint32* In, uint32* Out, int32 Num)
+	{
+		const int32 NumChunks = FMath::Min(FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 4, FMath::Max(Num / 4096, 1));
+		const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+
+		TArray<uint32> ChunkOffsets;
+		ChunkOffsets.SetNumZeroed(NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+			uint32 Sum = 0;
+			for (int32 i = Chunk * ChunkSize; i < End; i++)
+			{
+				Sum += In[i];
+			}
+			ChunkOffsets[Chunk] = Sum;
+		});
+
+		uint32 Running = 0;
+		for (uint32& Offset : ChunkOffsets)
+		{
+			const uint32 Sum = Offset;
+			Offset = Running;
+			Running += Sum;
+		}
+
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+			uint32 Sum = ChunkOffsets[Chunk];
+			for (int32 i = Chunk * ChunkSize; i < End; i++)
+			{
+				const uint32 Value = In[i];
+				Out[i] = Sum;
+				Sum += Value;
+			}
+		});
+	}
+
+	//Sorts power of two many chunks in parallel, then merges pairs of runs in parallel rounds
+	void ParallelMergeSort(TArray<uint32>& Keys)
+	{
+		const int32 Num = Keys.Num();
+		const int32 NumChunks = FMath::Min(FMath::RoundUpToPowerOfTwo(FPlatformMisc::NumberOfCoresIncludingHyperthreads()), (uint32)FMath::Max(Num / 4096, 1));
+		const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 Start = FMath::Min(Num, Chunk * ChunkSize);
+			const int32 End = FMath::Min(Num, Start + ChunkSize);
+			TArrayView<uint32> Run(Keys.GetData() + Start, End - Start);
+			Algo::Sort(Run);
+		});
+
+		TArray<uint32> Temp;
+		Temp.SetNumUninitialized(Num);
+
+		uint32* Src = Keys.GetData();
+		uint32* Dst = Temp.GetData();
+		for (int32 RunSize = ChunkSize; RunSize < Num; RunSize *= 2)
+		{
+			const int32 NumMerges = FMath::DivideAndRoundUp(Num, RunSize * 2);
+			ParallelFor(NumMerges, [&](int32 Merge)
+			{
+				int32 Left = Merge * RunSize * 2;
+				const int32 Mid = FMath::Min(Num, Left + RunSize);
+				const int32 End = FMath::Min(Num, Mid + RunSize);
+
+				int32 Right = Mid;
+				int32 Out = Left;
+				while (Left < Mid && Right < End)
+				{
+					Dst[Out++] = Src[Right] < Src[Left] ? Src[Right++] : Src[Left++];
+				}
+				while (Left < Mid)
+				{
+					Dst[Out++] = Src[Left++];
+				}
+				while (Right < End)
+				{
+					Dst[Out++] = Src[Right++];
+				}
+			});
+			Swap(Src, Dst);
+		}
+
+		if (Src != Keys.GetData())
+		{
+			FMemory::Memcpy(Keys.GetData(), Src, Num * sizeof(uint32));
+		}
+	}
+
+	//Every invocation advances ACCUMULATORS independent vec4 FMA chains. The multiplier and addend come from
+	//params so nothing folds, the chains settle around 1.0 so f16 stays finite.
+	const char* FlopsSource = (R"(
+ENABLE_F16
+
+@group(0) @binding(0) var<storage, read_write> sink: array<f32>;
+
+struct Params {
+	iterations: u32,
+	pad0: u32,
+	mul: f32,
+	add: f32,
+}
+
+@group(1) @binding(0) var<uniform> params: Params;
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(global_invocation_id) gid: vec3<u32>) {
+	let m = vec4<SCALAR>(SCALAR(params.mul));
+	let c = vec4<SCALAR>(SCALAR(params.add));
+	let s = vec4<SCALAR>(SCALAR(gid.x & 15u)) + vec4<SCALAR>(SCALAR(0.0), SCALAR(0.25), SCALAR(0.5), SCALAR(0.75));
+ACC_DECL
+	for (var i = 0u; i < params.iterations; i++) {
+ACC_FMA
+	}
+	let total = ACC_SUM;
+	sink[gid.x] = f32(total.x + total.y + total.z + total.w);
+}
+		)");
+
+	//Element count comes from the bound range, so one set of buffers serves every working set without params
+	const char* BandwidthSource = (R"(
+@group(0) @binding(0) var<storage, read_write> a: array<vec4<f32>>;
+@group(0) @binding(1) var<storage, read> b: array<vec4<f32>>;
+@group(0) @binding(2) var<storage, read> c: array<vec4<f32>>;
+
+const WG: u32 = 256u;
+
+fn element_index(wid: vec3<u32>, nwg: vec3<u32>, lid: u32) -> u32 {
+	return (wid.y * nwg.x + wid.x) * WG + lid;
+}
+
+@compute
+@workgroup_size(256)
+fn copy_kernel(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let i = element_index(wid, nwg, lid);
+	if (i < arrayLength(&a)) {
+		a[i] = b[i];
+	}
+}
+
+@compute
+@workgroup_size(256)
+fn triad_kernel(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let i = element_index(wid, nwg, lid);
+	if (i < arrayLength(&a)) {
+		a[i] = b[i] + 3.0 * c[i];
+	}
+}
+		)");
+
+	//Blocks until Buffer is mapped, false if mapping failed
+	bool MapBufferSync(WGPUDevice Device, WGPUBuffer Buffer, WGPUMapMode Mode, uint64 Size)
+	{
+		bool bMapped = false;
+		bool bDone = false;
+
+		WGPUBufferMapCallbackInfo MapInfo = {};
+		MapInfo.mode = WGPUCallbackMode_AllowProcessEvents;
+		MapInfo.userdata1 = &bMapped;
+		MapInfo.userdata2 = &bDone;
+		MapInfo.callback = [](WGPUMapAsyncStatus Status, WGPUStringView Message, void* UserData1, void* UserData2)
+		{
+			*reinterpret_cast<bool*>(UserData1) = Status == WGPUMapAsyncStatus_Success;
+			*reinterpret_cast<bool*>(UserData2) = true;
+		};
+
+		wgpuBufferMapAsync(Buffer, Mode, 0, Size, MapInfo);
+		while (!bDone)
+		{
+			wgpuDevicePoll(Device, true, nullptr);
+		}
+		return bMapped;
+	}
+
+	//Touches its binding only in a branch that never runs, so the dispatch does no memory traffic
+	const char* EmptySource = (R"(
+@group(0) @binding(0) var<storage, read_write> data: array<u32>;
+
+@compute
+@workgroup_size(64)
+fn main(@builtin(global_invocation_id) gid: vec3<u32>) {
+	if (gid.x == 0xffffffffu) {
+		data[0] = 0u;
+	}
+}
+		)");
+
+	//Compile corpus, SALT is replaced per compile so cold runs can't hit the driver's shader cache
+	struct FCompileCase
+	{
+		const TCHAR* Name;
+		FString Source;
+	};
+
+	const char* CompileSmallSource = (R"(
+@group(0) @binding(0) var<storage, read_write> data: array<u32>;
+
+@compute
+@workgroup_size(64)
+fn main(@builtin(global_invocation_id) gid: vec3<u32>) {
+	if (gid.x < arrayLength(&data)) {
+		data[gid.x] = data[gid.x] * 2u + SALTu;
+	}
+}
+		)");
+
+	const char* CompileLoopsSource = (R"(
+@group(0) @binding(0) var<storage, read> src: array<f32>;
+@group(0) @binding(1) var<storage, read_write> dst: array<f32>;
+
+var<workgroup> tile: array<f32, 256>;
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>) {
+	var acc = 0.0;
+	for (var i = 0u; i < 16u; i++) {
+		for (var j = 0u; j < 4u; j++) {
+			let idx = (wid.x * 16u + i) * 1024u + j * 256u + lid;
+			if (idx < arrayLength(&src)) {
+				acc = fma(src[idx], f32(j + SALTu), acc);
+			}
+		}
+	}
+
+	tile[lid] = acc;
+	workgroupBarrier();
+	for (var stride = 128u; stride > 0u; stride >>= 1u) {
+		if (lid < stride) {
+			tile[lid] += tile[lid + stride];
+		}
+		workgroupBarrier();
+	}
+
+	if (lid == 0u) {
+		dst[wid.x] = tile[0];
+	}
+}
+		)");
+
+	//Many small functions chained together, roughly the size of the noise / FFT kernels
+	FString MakeCompileLargeSource()
+	{
+		FString Source = TEXT("@group(0) @binding(0) var<storage, read_write> data: array<f32>;\n\n");
+		const int32 NumFunctions = 48;
+		for (int32 i = 0; i < NumFunctions; i++)
+		{
+			Source += FString::Printf(TEXT("fn f%d(x: f32) -> f32 {\n\tvar v = x;\n\tfor (var k = 0u; k < %du; k++) {\n\t\tv = fma(v, %d.5, sin(v)) * 0.5;\n\t}\n\treturn v + cos(x * %d.25);\n}\n\n"), i, (i % 4) + 1, i, i);
+		}
+
+		Source += TEXT("@compute\n@workgroup_size(64)\nfn main(@builtin(global_invocation_id) gid: vec3<u32>) {\n\tif (gid.x >= arrayLength(&data)) {\n\t\treturn;\n\t}\n\tvar v = data[gid.x] + f32(SALTu);\n");
+		for (int32 i = 0; i < NumFunctions; i++)
+		{
+			Source += FString::Printf(TEXT("\tv = f%d(v);\n"), i);
+		}
+		Source += TEXT("\tdata[gid.x] = v;\n}\n");
+		return Source;
+	}
+
+	//7 read-only inputs, one output and a uniform block, the binding count of our widest kernels
+	FString MakeCompileBindingsSource()
+	{
+		const int32 NumInputs = 7;
+		FString Source = TEXT("struct Params {\n\tscale: f32,\n\tpad0: u32,\n\tpad1: u32,\n\tpad2: u32,\n}\n\n@group(1) @binding(0) var<uniform> params: Params;\n");
+		FString Sum;
+		for (int32 i = 0; i < NumInputs; i++)
+		{
+			Source += FString::Printf(TEXT("@group(0) @binding(%d) var<storage, read> in%d: array<f32>;\n"), i, i);
+			Sum += FString::Printf(TEXT("%sin%d[i]"), i > 0 ? TEXT(" + ") : TEXT(""), i);
+		}
+		Source += FString::Printf(TEXT("@group(0) @binding(%d) var<storage, read_write> result: array<f32>;\n\n"), NumInputs);
+		Source += FString::Printf(TEXT("@compute\n@workgroup_size(64)\nfn main(@builtin(global_invocation_id) gid: vec3<u32>) {\n\tlet i = gid.x;\n\tif (i < arrayLength(&result)) {\n\t\tresult[i] = (%s) * params.scale + f32(SALTu);\n\t}\n}\n"), *Sum);
+		return Source;
+	}
+
+	const TCHAR* GetBackendName(WGPUBackendType Backend)
+	{
+		switch (Backend)
+		{
+		case WGPUBackendType_D3D11: return TEXT("D3D11");
+		case WGPUBackendType_D3D12: return TEXT("D3D12");
+		case WGPUBackendType_Metal: return TEXT("Metal");
+		case WGPUBackendType_Vulkan: return TEXT("Vulkan");
+		case WGPUBackendType_OpenGL: return TEXT("OpenGL");
+		case WGPUBackendType_OpenGLES: return TEXT("OpenGLES");
+		default: return TEXT("Unknown");
+		}
+	}
+
+	struct FFlopsParams
+	{
+		uint32 Iterations;
+		uint32 Pad0;
+		float Mul;
+		float Add;
+	};
+
+	FString MakeFlopsSource(const TCHAR* Scalar, int32 Accumulators)
+	{
+		FString Decl;
+		FString Fma;
+		FString Sum;
+		for (int32 i = 0; i < Accumulators; i++)
+		{
+			Decl += FString::Printf(TEXT("\tvar a%d = s + vec4<SCALAR>(SCALAR(%d));\n"), i, i);
+			Fma += FString::Printf(TEXT("\t\ta%d = fma(a%d, m, c);\n"), i, i);
+			Sum += FString::Printf(TEXT("%sa%d"), i > 0 ? TEXT(" + ") : TEXT(""), i);
+		}
+
+		FString Source = FString(FlopsSource);
+		Source.ReplaceInline(TEXT("ACC_DECL"), *Decl);
+		Source.ReplaceInline(TEXT("ACC_FMA"), *Fma);
+		Source.ReplaceInline(TEXT("ACC_SUM"), *Sum);
+		Source.ReplaceInline(TEXT("ENABLE_F16"), FString(Scalar) == TEXT("f16") ? TEXT("enable f16;") : TEXT(""));
+		Source.ReplaceInline(TEXT("SCALAR"), Scalar);
+		return Source;
+	}
+}
+
+FWebGPUBenchmark::FWebGPUBenchmark(FWebGPUContext& InContext)
+	: Context(InContext)
+{
+}
+
+void FWebGPUBenchmark::WaitForGPU()
+{
+	wgpuDevicePoll(Context.Device, true, nullptr);
+}
+
+double FWebGPUBenchmark::TimeComputePass(TFunctionRef<void(WGPUComputePassEncoder)> Encode, bool* bOutUsedTimestamps)
+{
+	const bool bTimestamps = Context.HasFeature(WGPUFeatureName_TimestampQuery);
+
+	WGPUQuerySet QuerySet = nullptr;
+	WGPUBuffer ResolveBuffer = nullptr;
+	WGPUComputePassTimestampWrites TimestampWrites = {};
+	if (bTimestamps)
+	{
+		WGPUQuerySetDescriptor QuerySetDesc = {};
+		QuerySetDesc.label = { "bench_timestamps", WGPU_STRLEN };
+		QuerySetDesc.type = WGPUQueryType_Timestamp;
+		QuerySetDesc.count = 2;
+		QuerySet = wgpuDeviceCreateQuerySet(Context.Device, &QuerySetDesc);
+		assert(QuerySet);
+
+		ResolveBuffer = Context.CreateBuffer(2 * sizeof(uint64), WGPUBufferUsage_QueryResolve | WGPUBufferUsage_CopySrc, "bench_timestamp_resolve_buffer");
+
+		TimestampWrites.querySet = QuerySet;
+		TimestampWrites.beginningOfPassWriteIndex = 0;
+		TimestampWrites.endOfPassWriteIndex = 1;
+	}
+
+	WGPUComputePassDescriptor PassDesc = {};
+	PassDesc.label = { "bench_pass", WGPU_STRLEN };
+	PassDesc.timestampWrites = bTimestamps ? &TimestampWrites : nullptr;
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context.Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, &PassDesc);
+
+	Encode(ComputePassEncoder);
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	if (bTimestamps)
+	{
+		wgpuCommandEncoderResolveQuerySet(CommandEncoder, QuerySet, 0, 2, ResolveBuffer, 0);
+	}
+
+	const double Start = FPlatformTime::Seconds();
+	Context.Submit(CommandEncoder);
+	WaitForGPU();
+	const double WallSeconds = FPlatformTime::Seconds() - Start;
+
+	double Seconds = WallSeconds;
+	bool bUsedTimestamps = false;
+	if (bTimestamps)
+	{
+		uint64 Stamps[2] = { 0, 0 };
+		if (Context.ReadBufferSync(ResolveBuffer, 0, sizeof(Stamps), Stamps) && Stamps[1] > Stamps[0])
+		{
+			//Timestamps are nanoseconds, a span longer than the submit took means the backend handed out raw ticks
+			const double GPUSeconds = (Stamps[1] - Stamps[0]) * 1e-9;
+			if (GPUSeconds <= WallSeconds * 1.5)
+			{
+				Seconds = GPUSeconds;
+				bUsedTimestamps = true;
+			}
+			else
+			{
+				UE_LOG(LogWebGPUBenchmark, Warning, TEXT("GPU timestamps (%.6fs) exceed the wall time (%.6fs), using wall time"), GPUSeconds, WallSeconds);
+			}
+		}
+
+		wgpuBufferRelease(ResolveBuffer);
+		wgpuQuerySetRelease(QuerySet);
+	}
+
+	if (bOutUsedTimestamps)
+	{
+		*bOutUsedTimestamps = bUsedTimestamps;
+	}
+	return Seconds;
+}
+
+void FWebGPUBenchmark::BenchmarkScan(int32 NumElements, int32 Iterations)
+{
+	NumElements = FMath::Max(NumElements, 1);
+	Iterations = FMath::Max(Iterations, 1);
+
+	TArray<uint32> Input;
+	Input.SetNumUninitialized(NumElements);
+
+	FRandomStream Random(1337);
+	for (uint32& Value : Input)
+	{
+		Value = Random.GetUnsignedInt() & 0xff;
+	}
+
+	const uint64 DataSize = (uint64)NumElements * sizeof(uint32);
+
+	FWebGPUScan Scan;
+	Scan.Initialize(Context);
+
+	WGPUBuffer InputBuffer = Context.CreateBuffer(DataSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "bench_scan_input_buffer");
+	WGPUBuffer OutputBuffer = Context.CreateBuffer(DataSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc, "bench_scan_output_buffer");
+	wgpuQueueWriteBuffer(Context.Queue, InputBuffer, 0, Input.GetData(), DataSize);
+
+	//Warmup compiles the kernels and allocates the level buffers
+	if (!Scan.Scan(InputBuffer, OutputBuffer, NumElements, false))
+	{
+		UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU Scan] Failed to encode scan"));
+		wgpuBufferRelease(OutputBuffer);
+		wgpuBufferRelease(InputBuffer);
+		return;
+	}
+	WaitForGPU();
+
+	//A dropped dispatch leaves the output stale, report it like a failed readback
+	bool bEncoded = true;
+	double Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		bEncoded &= Scan.Scan(InputBuffer, OutputBuffer, NumElements, false);
+	}
+	WaitForGPU();
+	const double GPUSeconds = (FPlatformTime::Seconds() - Start) / Iterations;
+
+	TArray<uint32> GPUResult;
+	GPUResult.SetNumUninitialized(NumElements);
+	const bool bReadBack = bEncoded && Context.ReadBufferSync(OutputBuffer, 0, DataSize, GPUResult.GetData());
+
+	TArray<uint32> CPUResult;
+	CPUResult.SetNumUninitialized(NumElements);
+
+	Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		ParallelExclusiveScan(Input.GetData(), CPUResult.GetData(), NumElements);
+	}
+	const double CPUSeconds = (FPlatformTime::Seconds() - Start) / Iterations;
+
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < NumElements && bReadBack; i++)
+	{
+		Mismatches += GPUResult[i] != CPUResult[i] ? 1 : 0;
+	}
+
+	//One read and one write per element
+	const double Bytes = 2.0 * DataSize;
+
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Scan] Elements: %d, Iterations: %d"), NumElements, Iterations);
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Scan] Time: %.3fms, %.2f Gelem/s, %.2f GB/s"), GPUSeconds * 1e3, (NumElements / GPUSeconds) / 1e9, (Bytes / GPUSeconds) / 1e9);
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[CPU Scan MT] Time: %.3fms, %.2f Gelem/s, %.2f GB/s"), CPUSeconds * 1e3, (NumElements / CPUSeconds) / 1e9, (Bytes / CPUSeconds) / 1e9);
+
+	if (!bReadBack || Mismatches > 0)
+	{
+		UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU Scan] Result mismatch: %d elements differ from the CPU scan"), bReadBack ? Mismatches : NumElements);
+	}
+
+	wgpuBufferRelease(OutputBuffer);
+	wgpuBufferRelease(InputBuffer);
+}
+
+void FWebGPUBenchmark::BenchmarkRadixSort(int32 NumKeys, int32 Iterations)
+{
+	NumKeys = FMath::Max(NumKeys, 2);
+	Iterations = FMath::Max(Iterations, 1);
+
+	TArray<uint32> Keys;
+	TArray<uint32> Payload;
+	Keys.SetNumUninitialized(NumKeys);
+	Payload.SetNumUninitialized(NumKeys);
+
+	FRandomStream Random(1337);
+	for (int32 i = 0; i < NumKeys; i++)
+	{
+		Keys[i] = Random.GetUnsignedInt();
+		Payload[i] = i;
+	}
+
+	const uint64 DataSize = (uint64)NumKeys * sizeof(uint32);
+
+	FWebGPURadixSort RadixSort;
+	RadixSort.Initialize(Context);
+
+	WGPUBuffer KeysBuffer = Context.CreateBuffer(DataSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "bench_sort_keys_buffer");
+	WGPUBuffer PayloadBuffer = Context.CreateBuffer(DataSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "bench_sort_payload_buffer");
+
+	//Each sort gets fresh unsorted input, the upload is timed along with it
+	bool bEncoded = true;
+	auto TimeGPUSort = [&](bool bWithPayload) -> double
+	{
+		wgpuQueueWriteBuffer(Context.Queue, KeysBuffer, 0, Keys.GetData(), DataSize);
+		wgpuQueueWriteBuffer(Context.Queue, PayloadBuffer, 0, Payload.GetData(), DataSize);
+		bEncoded &= RadixSort.Sort(KeysBuffer, bWithPayload ? PayloadBuffer : nullptr, NumKeys);
+		WaitForGPU();
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; i++)
+		{
+			wgpuQueueWriteBuffer(Context.Queue, KeysBuffer, 0, Keys.GetData(), DataSize);
+			bEncoded &= RadixSort.Sort(KeysBuffer, bWithPayload ? PayloadBuffer : nullptr, NumKeys);
+		}
+		WaitForGPU();
+		return (FPlatformTime::Seconds() - Start) / Iterations;
+	};
+
+	const double GPUKeysSeconds = TimeGPUSort(false);
+	const double GPUPairsSeconds = TimeGPUSort(true);
+
+	//Timed pair sorts reuse an already permuted payload, validate one sort from the original input
+	wgpuQueueWriteBuffer(Context.Queue, KeysBuffer, 0, Keys.GetData(), DataSize);
+	wgpuQueueWriteBuffer(Context.Queue, PayloadBuffer, 0, Payload.GetData(), DataSize);
+	bEncoded &= RadixSort.Sort(KeysBuffer, PayloadBuffer, NumKeys);
+
+	TArray<uint32> GPUKeys;
+	TArray<uint32> GPUPayload;
+	GPUKeys.SetNumUninitialized(NumKeys);
+	GPUPayload.SetNumUninitialized(NumKeys);
+	const bool bReadBack = bEncoded && Context.ReadBufferSync(KeysBuffer, 0, DataSize, GPUKeys.GetData()) &&
+		Context.ReadBufferSync(PayloadBuffer, 0, DataSize, GPUPayload.GetData());
+
+	TArray<uint32> ReferenceKeys = Keys;
+	TArray<uint32> ReferencePayload = Payload;
+	FWebGPURadixSort::SortOnCPU(ReferenceKeys, &ReferencePayload);
+
+	TArray<uint32> CPUKeys;
+	double Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		CPUKeys = Keys;
+		Algo::Sort(CPUKeys);
+	}
+	const double AlgoSortSeconds = (FPlatformTime::Seconds() - Start) / Iterations;
+
+	Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		CPUKeys = Keys;
+		ParallelMergeSort(CPUKeys);
+	}
+	const double ParallelSortSeconds = (FPlatformTime::Seconds() - Start) / Iterations;
+
+	//Stable sort, so payloads have to match the reference exactly too
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < NumKeys && bReadBack; i++)
+	{
+		Mismatches += (GPUKeys[i] != ReferenceKeys[i] || GPUPayload[i] != ReferencePayload[i] || CPUKeys[i] != ReferenceKeys[i]) ? 1 : 0;
+	}
+
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Radix Sort] Keys: %d, Iterations: %d"), NumKeys, Iterations);
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Radix Sort] Keys only: %.3fms, %.2f Mkeys/s"), GPUKeysSeconds * 1e3, (NumKeys / GPUKeysSeconds) / 1e6);
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Radix Sort] Key+payload: %.3fms, %.2f Mkeys/s"), GPUPairsSeconds * 1e3, (NumKeys / GPUPairsSeconds) / 1e6);
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[CPU Algo::Sort] %.3fms, %.2f Mkeys/s"), AlgoSortSeconds * 1e3, (NumKeys / AlgoSortSeconds) / 1e6);
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[CPU Merge Sort MT] %.3fms, %.2f Mkeys/s"), ParallelSortSeconds * 1e3, (NumKeys / ParallelSortSeconds) / 1e6);
+
+	if (!bReadBack || Mismatches > 0)
+	{
+		UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU Radix Sort] Result mismatch: %d keys differ from the CPU reference"), bReadBack ? Mismatches : NumKeys);
+	}
+
+	wgpuBufferRelease(PayloadBuffer);
+	wgpuBufferRelease(KeysBuffer);
+}
+
+void FWebGPUBenchmark::BenchmarkGemm(int32 Size, int32 Iterations, bool bFloat16)
+{
+	Size = FMath::Max(Size, 1);
+	Iterations = FMath::Max(Iterations, 1);
+
+	const TCHAR* Label = bFloat16 ? TEXT("f16") : TEXT("f32");
+
+	FWebGPUGemmConfig Config;
+	Config.bFloat16 = bFloat16;
+
+	FWebGPUGemm Gemm;
+	if (!Gemm.Initialize(Context, Config))
+	{
+		UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU GEMM %s] Not available on this device"), Label);
+		return;
+	}
+
+	const int32 NumElements = Size * Size;
+
+	TArray<float> A;
+	TArray<float> B;
+	A.SetNumUninitialized(NumElements);
+	B.SetNumUninitialized(NumElements);
+
+	FRandomStream Random(1337);
+	for (int32 i = 0; i < NumElements; i++)
+	{
+		A[i] = Random.GetFraction() - 0.5f;
+		B[i] = Random.GetFraction() - 0.5f;
+	}
+
+	//Exact size is what gets compared, buffers and copies are padded to the 4 byte multiple
+	//queue writes and buffer copies need (an odd count of f16 elements isn't one)
+	const uint64 MatrixSize = (uint64)NumElements * Gemm.GetElementSize();
+	const uint64 BufferSize = Align(MatrixSize, (uint64)4);
+
+	//f16 inputs are rounded once up front so the cpu reference sees the same values
+	TArray<FFloat16> AHalf;
+	TArray<FFloat16> BHalf;
+	if (bFloat16)
+	{
+		AHalf.SetNumZeroed(BufferSize / sizeof(FFloat16));
+		BHalf.SetNumZeroed(BufferSize / sizeof(FFloat16));
+		for (int32 i = 0; i < NumElements; i++)
+		{
+			AHalf[i] = FFloat16(A[i]);
+			BHalf[i] = FFloat16(B[i]);
+			A[i] = AHalf[i].GetFloat();
+			B[i] = BHalf[i].GetFloat();
+		}
+	}
+
+	const void* AData = bFloat16 ? (const void*)AHalf.GetData() : (const void*)A.GetData();
+	const void* BData = bFloat16 ? (const void*)BHalf.GetData() : (const void*)B.GetData();
+
+	WGPUBuffer ABuffer = Context.CreateBuffer(BufferSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "bench_gemm_a_buffer");
+	WGPUBuffer BBuffer = Context.CreateBuffer(BufferSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "bench_gemm_b_buffer");
+	WGPUBuffer CBuffer = Context.CreateBuffer(BufferSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc, "bench_gemm_c_buffer");
+	wgpuQueueWriteBuffer(Context.Queue, ABuffer, 0, AData, BufferSize);
+	wgpuQueueWriteBuffer(Context.Queue, BBuffer, 0, BData, BufferSize);
+
+	bool bEncoded = Gemm.Multiply(ABuffer, BBuffer, CBuffer, Size, Size, Size);
+	WaitForGPU();
+
+	double Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		bEncoded &= Gemm.Multiply(ABuffer, BBuffer, CBuffer, Size, Size, Size);
+	}
+	WaitForGPU();
+	const double GPUSeconds = (FPlatformTime::Seconds() - Start) / Iterations;
+
+	TArray<uint8> GPUResult;
+	GPUResult.SetNumUninitialized(BufferSize);
+	const bool bReadBack = bEncoded && Context.ReadBufferSync(CBuffer, 0, BufferSize, GPUResult.GetData());
+
+	//i-k-j order keeps the inner loop streaming through rows of B and C
+	TArray<float> CPUResult;
+	CPUResult.SetNumZeroed(NumElements);
+
+	Start = FPlatformTime::Seconds();
+	ParallelFor(Size, [&](int32 Row)
+	{
+		float* CRow = CPUResult.GetData() + (int64)Row * Size;
+		for (int32 k = 0; k < Size; k++)
+		{
+			const float AValue = A[Row * Size + k];
+			const float* BRow = B.GetData() + (int64)k * Size;
+			for (int32 Col = 0; Col < Size; Col++)
+			{
+				CRow[Col] += AValue * BRow[Col];
+			}
+		}
+	});
+	const double CPUSeconds = FPlatformTime::Seconds() - Start;
+
+	//Summation order differs, compare against a tolerance scaled by K
+	const float Tolerance = (bFloat16 ? 1e-2f : 1e-4f) * FMath::Sqrt((float)Size);
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < NumElements && bReadBack; i++)
+	{
+		const float GPUValue = bFloat16 ? reinterpret_cast<const FFloat16*>(GPUResult.GetData())[i].GetFloat() : reinterpret_cast<const float*>(GPUResult.GetData())[i];
+		Mismatches += FMath::Abs(GPUValue - CPUResult[i]) > Tolerance ? 1 : 0;
+	}
+
+	const double Flops = 2.0 * Size * Size * Size;
+
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU GEMM %s] Size: %dx%d, Tile: %ux%ux%u, Iterations: %d"), Label, Size, Size, Config.TileM, Config.TileN, Config.TileK, Iterations);
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU GEMM %s] Elapsed Time: %.6fs"), Label, GPUSeconds);
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU GEMM %s] FLOPs/s: %.2f GFLOPs"), Label, (Flops / GPUSeconds) / 1e9);
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[CPU GEMM MT] Elapsed Time: %.6fs"), CPUSeconds);
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[CPU GEMM MT] FLOPs/s: %.2f GFLOPs"), (Flops / CPUSeconds) / 1e9);
+
+	if (!bReadBack || Mismatches > 0)
+	{
+		UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU GEMM %s] Result mismatch: %d elements outside tolerance"), Label, bReadBack ? Mismatches : NumElements);
+	}
+
+	wgpuBufferRelease(CBuffer);
+	wgpuBufferRelease(BBuffer);
+	wgpuBufferRelease(ABuffer);
+}
+
+void FWebGPUBenchmark::BenchmarkNoise(int32 TileSize, int32 Iterations, int32 Octaves)
+{
+	TileSize = FMath::Max(TileSize, 1);
+	Iterations = FMath::Max(Iterations, 1);
+
+	FWebGPUNoise Noise;
+	Noise.Initialize(Context);
+
+	const int32 NumPixels = TileSize * TileSize;
+	WGPUBuffer TileBuffer = Context.CreateBuffer((uint64)NumPixels * sizeof(float), WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc, "bench_noise_tile_buffer");
+
+	struct FNoiseCase
+	{
+		const TCHAR* Label;
+		EWebGPUNoiseType Type;
+		float WarpStrength;
+	};
+	const FNoiseCase Cases[] = {
+		{ TEXT("Gradient2D"), EWebGPUNoiseType::Gradient2D, 0.f },
+		{ TEXT("Gradient3D"), EWebGPUNoiseType::Gradient3D, 0.f },
+		{ TEXT("Cellular2D"), EWebGPUNoiseType::Cellular2D, 0.f },
+		{ TEXT("Gradient2D Warped"), EWebGPUNoiseType::Gradient2D, 4.f },
+	};
+
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Noise] Tile: %dx%d, Octaves: %d, Iterations: %d"), TileSize, TileSize, Octaves, Iterations);
+
+	for (const FNoiseCase& Case : Cases)
+	{
+		FWebGPUNoiseSettings Settings;
+		Settings.Type = Case.Type;
+		Settings.Octaves = Octaves;
+		Settings.WarpStrength = Case.WarpStrength;
+		Settings.OriginZ = 17.5f;
+
+		//Walks a row of tiles so every iteration computes a fresh part of the field
+		bool bEncoded = true;
+		auto EncodeTile = [&](int32 Tile)
+		{
+			Settings.OriginX = (float)Tile * TileSize;
+
+			WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context.Device, nullptr);
+			WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+			bEncoded &= Noise.EncodeFill(ComputePassEncoder, FWebGPUImage::FromBuffer(TileBuffer), TileSize, TileSize, Settings);
+			wgpuComputePassEncoderEnd(ComputePassEncoder);
+			wgpuComputePassEncoderRelease(ComputePassEncoder);
+			Context.Submit(CommandEncoder);
+		};
+
+		EncodeTile(0);
+		WaitForGPU();
+
+		double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; i++)
+		{
+			EncodeTile(i);
+		}
+		WaitForGPU();
+		const double GPUSeconds = (FPlatformTime::Seconds() - Start) / Iterations;
+
+		TArray<float> GPUResult;
+		GPUResult.SetNumUninitialized(NumPixels);
+		const bool bReadBack = bEncoded && Context.ReadBufferSync(TileBuffer, 0, (uint64)NumPixels * sizeof(float), GPUResult.GetData());
+
+		TArray<float> CPUResult;
+		Start = FPlatformTime::Seconds();
+		FWebGPUNoise::FillCPU(TileSize, TileSize, Settings, CPUResult);
+		const double CPUSeconds = FPlatformTime::Seconds() - Start;
+
+		//Texels right on a lattice line may floor into the neighbouring cell on one side, so a few outliers are fine
+		float MaxError = 0.f;
+		int32 Mismatches = 0;
+		for (int32 i = 0; i < NumPixels && bReadBack; i++)
+		{
+			const float Error = FMath::Abs(GPUResult[i] - CPUResult[i]);
+			MaxError = FMath::Max(MaxError, Error);
+			Mismatches += Error > 1e-3f ? 1 : 0;
+		}
+
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Noise %s] Elapsed Time: %.6fs, Tiles/s: %.1f, MPixels/s: %.1f"), Case.Label, GPUSeconds, 1.0 / GPUSeconds, (NumPixels / GPUSeconds) / 1e6);
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[CPU Noise %s MT] Elapsed Time: %.6fs, Tiles/s: %.1f, MPixels/s: %.1f"), Case.Label, CPUSeconds, 1.0 / CPUSeconds, (NumPixels / CPUSeconds) / 1e6);
+
+		if (!bReadBack || Mismatches > NumPixels / 1000)
+		{
+			UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU Noise %s] Result mismatch: %d texels differ from the cpu reference (max error %f)"), Case.Label, bReadBack ? Mismatches : NumPixels, MaxError);
+		}
+	}
+
+	wgpuBufferRelease(TileBuffer);
+}
+
+void FWebGPUBenchmark::BenchmarkFlops(int32 Iterations)
+{
+	Iterations = FMath::Max(Iterations, 1);
+
+	//8 x vec4 chains hide FMA latency on every GPU we run on, 1M invocations fill any device
+	const int32 Accumulators = 8;
+	const uint32 WorkgroupSize = 256;
+	const uint32 NumWorkgroups = 4096;
+	const uint32 NumInvocations = WorkgroupSize * NumWorkgroups;
+
+	struct FFlopsCase
+	{
+		const TCHAR* Scalar;
+		bool bSupported;
+		uint32 LoopIterations;
+	};
+
+	//Consumer GPUs run f64 at 1/16 - 1/64 rate, fewer loops keep each dispatch clear of driver timeouts
+	const FFlopsCase Cases[] = {
+		{ TEXT("f32"), true, 256 },
+		{ TEXT("f16"), Context.HasFeature(WGPUFeatureName_ShaderF16), 256 },
+		{ TEXT("f64"), Context.HasNativeFeature(WGPUNativeFeature_ShaderF64), 16 },
+	};
+
+	WGPUBuffer SinkBuffer = Context.CreateBuffer((uint64)NumInvocations * sizeof(float), WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc, "bench_flops_sink_buffer");
+
+	for (const FFlopsCase& Case : Cases)
+	{
+		if (!Case.bSupported)
+		{
+			UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU FLOPs %s] Not supported on this device"), Case.Scalar);
+			continue;
+		}
+
+		FWebGPUKernel Kernel;
+		if (!Kernel.Create(Context, MakeFlopsSource(Case.Scalar, Accumulators), { WGPUBufferBindingType_Storage }, true))
+		{
+			UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU FLOPs %s] Kernel failed to compile"), Case.Scalar);
+			continue;
+		}
+
+		FFlopsParams Params = {};
+		Params.Iterations = Case.LoopIterations;
+		Params.Mul = 0.999f;
+		Params.Add = 0.001f;
+
+		WGPUBindGroup BindGroup = Kernel.CreateBindGroup(TArray<WGPUBuffer>({ SinkBuffer }));
+
+		int32 NumDispatches = 1;
+		bool bEncoded = true;
+		auto EncodeDispatches = [&](WGPUComputePassEncoder Pass)
+		{
+			for (int32 i = 0; i < NumDispatches && bEncoded; i++)
+			{
+				bEncoded = Kernel.Dispatch(Pass, BindGroup, Params, NumWorkgroups);
+			}
+		};
+
+		TimeComputePass(EncodeDispatches);
+
+		NumDispatches = Iterations;
+		bool bUsedTimestamps = false;
+		const double Seconds = TimeComputePass(EncodeDispatches, &bUsedTimestamps);
+
+		float Checksum = 0.f;
+		const bool bReadBack = bEncoded && Context.ReadBufferSync(SinkBuffer, 0, sizeof(float), &Checksum);
+
+		wgpuBindGroupRelease(BindGroup);
+
+		const double Flops = 2.0 * 4 * Accumulators * (double)Case.LoopIterations * NumInvocations * Iterations;
+
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU FLOPs %s] Elapsed Time: %.6fs (%s)"), Case.Scalar, Seconds, bUsedTimestamps ? TEXT("gpu timestamps") : TEXT("wall time"));
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU FLOPs %s] Total FLOPs: %.0f"), Case.Scalar, Flops);
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU FLOPs %s] FLOPs/s: %.2f GFLOPs"), Case.Scalar, (Flops / Seconds) / 1e9);
+
+		if (!bReadBack || !FMath::IsFinite(Checksum))
+		{
+			UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU FLOPs %s] Chains did not produce a finite result"), Case.Scalar);
+		}
+	}
+
+	wgpuBufferRelease(SinkBuffer);
+}
+
+void FWebGPUBenchmark::BenchmarkBandwidth(uint64 MinBytes, uint64 MaxBytes)
+{
+	const uint32 WorkgroupSize = 256;
+	const uint64 ElementSize = 4 * sizeof(float);
+
+	const WGPULimits& Limits = Context.GetLimits();
+	const uint64 MaxBindingSize = FMath::Min(Limits.maxStorageBufferBindingSize, Limits.maxBufferSize);
+
+	//Each array is a third of the working set
+	MinBytes = FMath::RoundUpToPowerOfTwo64(FMath::Max<uint64>(MinBytes, 4096));
+	MaxBytes = FMath::Max(FMath::Min(MaxBytes, MaxBindingSize * 3), MinBytes);
+	const uint64 MaxNum = MaxBytes / (3 * ElementSize);
+	const uint64 ArraySize = MaxNum * ElementSize;
+
+	FWebGPUKernel CopyKernel;
+	FWebGPUKernel TriadKernel;
+	const TArray<WGPUBufferBindingType> Bindings = { WGPUBufferBindingType_Storage, WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_ReadOnlyStorage };
+	if (!CopyKernel.Create(Context, BandwidthSource, Bindings, false, "copy_kernel") || !TriadKernel.Create(Context, BandwidthSource, Bindings, false, "triad_kernel"))
+	{
+		UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU Bandwidth] Kernels failed to compile"));
+		return;
+	}
+
+	WGPUBuffer Arrays[3];
+	TArray<float> Fill;
+	Fill.Init(1.f, MaxNum * 4);
+	for (int32 i = 0; i < 3; i++)
+	{
+		Arrays[i] = Context.CreateBuffer(ArraySize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "bench_bandwidth_buffer");
+		wgpuQueueWriteBuffer(Context.Queue, Arrays[i], 0, Fill.GetData(), ArraySize);
+	}
+	Fill.Empty();
+	WaitForGPU();
+
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Bandwidth] Max array size: %llu MB"), ArraySize / (1024 * 1024));
+
+	bool bUsedTimestamps = false;
+	for (uint64 WorkingSet = MinBytes; WorkingSet <= MaxBytes; WorkingSet *= 2)
+	{
+		const uint64 Num = FMath::Max<uint64>(WorkingSet / (3 * ElementSize), 1);
+		const uint32 Groups = (uint32)FMath::DivideAndRoundUp<uint64>(Num, WorkgroupSize);
+		uint32 GroupsX = 0;
+		uint32 GroupsY = 0;
+		Context.GetGroupCounts(Groups, GroupsX, GroupsY);
+
+		//Roughly 1 GB of traffic per measurement, small working sets are otherwise all launch overhead
+		const int32 Dispatches = (int32)FMath::Clamp<uint64>(1024ull * 1024 * 1024 / (Num * 3 * ElementSize), 2, 1024);
+
+		TArray<WGPUBindGroupEntry> Entries;
+		for (int32 i = 0; i < 3; i++)
+		{
+			WGPUBindGroupEntry& Entry = Entries.AddZeroed_GetRef();
+			Entry.binding = i;
+			Entry.buffer = Arrays[i];
+			Entry.size = Num * ElementSize;
+		}
+
+		double GBs[2];
+		FWebGPUKernel* Kernels[2] = { &CopyKernel, &TriadKernel };
+		const double BytesPerElement[2] = { 2.0 * ElementSize, 3.0 * ElementSize };
+		for (int32 k = 0; k < 2; k++)
+		{
+			WGPUBindGroup BindGroup = Kernels[k]->CreateBindGroup(Entries);
+
+			int32 NumDispatches = 1;
+			auto EncodeDispatches = [&](WGPUComputePassEncoder Pass)
+			{
+				for (int32 i = 0; i < NumDispatches; i++)
+				{
+					Kernels[k]->Dispatch(Pass, BindGroup, nullptr, 0, GroupsX, GroupsY);
+				}
+			};
+
+			TimeComputePass(EncodeDispatches);
+
+			NumDispatches = Dispatches;
+			const double Seconds = TimeComputePass(EncodeDispatches, &bUsedTimestamps);
+			GBs[k] = (BytesPerElement[k] * Num * Dispatches / Seconds) / 1e9;
+
+			wgpuBindGroupRelease(BindGroup);
+		}
+
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Bandwidth] %8llu KB: Copy %.1f GB/s, Triad %.1f GB/s"), (Num * 3 * ElementSize) / 1024, GBs[0], GBs[1]);
+	}
+
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Bandwidth] Timed with %s"), bUsedTimestamps ? TEXT("gpu timestamps") : TEXT("wall time"));
+
+	for (WGPUBuffer Array : Arrays)
+	{
+		wgpuBufferRelease(Array);
+	}
+}
+
+void FWebGPUBenchmark::BenchmarkTransfer(uint64 MinBytes, uint64 MaxBytes, int32 LatencyIterations)
+{
+	LatencyIterations = FMath::Max(LatencyIterations, 1);
+
+	const uint64 MaxBufferSize = Context.GetLimits().maxBufferSize;
+
+	//Copies need 4 byte multiples, and the host side is a TArray indexed with int32
+	const uint64 SizeCap = AlignDown(FMath::Min<uint64>(MaxBufferSize, MAX_int32), (uint64)4);
+	MinBytes = FMath::Min(FMath::Max<uint64>(Align(MinBytes, 4), 4), SizeCap);
+	MaxBytes = FMath::Max(AlignDown(FMath::Min(MaxBytes, SizeCap), (uint64)4), MinBytes);
+
+	//The map rings are under the same cap since MaxBytes is
+	const uint64 RingChunkBytes = FMath::Min<uint64>(16ull * 1024 * 1024, MaxBytes);
+
+	TArray<uint8> HostData;
+	HostData.SetNumUninitialized(MaxBytes);
+	FMemory::Memset(HostData.GetData(), 0x5a, MaxBytes);
+
+	WGPUBuffer DeviceBuffer = Context.CreateBuffer(MaxBytes, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "bench_transfer_device_buffer");
+
+	//Two slot rings like FWebGPUStreamingExecutor: one slot is filled / drained while the other copies
+	WGPUBuffer UploadRing[2];
+	WGPUBuffer ReadbackRing[2];
+	bool bUploadMapped[2] = { true, true };
+	for (int32 i = 0; i < 2; i++)
+	{
+		WGPUBufferDescriptor UploadDesc = {};
+		UploadDesc.label = { "bench_transfer_upload_ring", WGPU_STRLEN };
+		UploadDesc.usage = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
+		UploadDesc.size = RingChunkBytes;
+		UploadDesc.mappedAtCreation = true;
+		UploadRing[i] = wgpuDeviceCreateBuffer(Context.Device, &UploadDesc);
+		assert(UploadRing[i]);
+
+		ReadbackRing[i] = Context.CreateBuffer(RingChunkBytes, WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst, "bench_transfer_readback_ring");
+	}
+
+	auto CopyBuffer = [&](WGPUBuffer Src, uint64 SrcOffset, WGPUBuffer Dst, uint64 DstOffset, uint64 Size)
+	{
+		WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context.Device, nullptr);
+		wgpuCommandEncoderCopyBufferToBuffer(CommandEncoder, Src, SrcOffset, Dst, DstOffset, Size);
+		Context.Submit(CommandEncoder);
+	};
+
+	//Queue writes are staged until the next submit, an empty one flushes them
+	auto UploadWriteBuffer = [&](uint64 Size)
+	{
+		wgpuQueueWriteBuffer(Context.Queue, DeviceBuffer, 0, HostData.GetData(), Size);
+		Context.Submit(wgpuDeviceCreateCommandEncoder(Context.Device, nullptr));
+		WaitForGPU();
+	};
+
+	auto UploadMappedAtCreation = [&](uint64 Size)
+	{
+		WGPUBufferDescriptor MappedDesc = {};
+		MappedDesc.label = { "bench_transfer_mapped_buffer", WGPU_STRLEN };
+		MappedDesc.usage = WGPUBufferUsage_CopySrc;
+		MappedDesc.size = Size;
+		MappedDesc.mappedAtCreation = true;
+		WGPUBuffer MappedBuffer = wgpuDeviceCreateBuffer(Context.Device, &MappedDesc);
+		assert(MappedBuffer);
+
+		FMemory::Memcpy(wgpuBufferGetMappedRange(MappedBuffer, 0, Size), HostData.GetData(), Size);
+		wgpuBufferUnmap(MappedBuffer);
+
+		CopyBuffer(MappedBuffer, 0, DeviceBuffer, 0, Size);
+		WaitForGPU();
+		wgpuBufferRelease(MappedBuffer);
+	};
+
+	auto UploadStagingRing = [&](uint64 Size)
+	{
+		int32 Slot = 0;
+		for (uint64 Offset = 0; Offset < Size; Offset += RingChunkBytes, Slot ^= 1)
+		{
+			const uint64 Bytes = FMath::Min(RingChunkBytes, Size - Offset);
+
+			//Waits for the copy that last used this slot
+			if (!bUploadMapped[Slot])
+			{
+				bUploadMapped[Slot] = MapBufferSync(Context.Device, UploadRing[Slot], WGPUMapMode_Write, RingChunkBytes);
+				if (!bUploadMapped[Slot])
+				{
+					return;
+				}
+			}
+
+			FMemory::Memcpy(wgpuBufferGetMappedRange(UploadRing[Slot], 0, RingChunkBytes), HostData.GetData() + Offset, Bytes);
+			wgpuBufferUnmap(UploadRing[Slot]);
+			bUploadMapped[Slot] = false;
+
+			CopyBuffer(UploadRing[Slot], 0, DeviceBuffer, Offset, Bytes);
+		}
+		WaitForGPU();
+	};
+
+	auto ReadbackMapAsync = [&](uint64 Size)
+	{
+		Context.ReadBufferSync(DeviceBuffer, 0, Size, HostData.GetData());
+	};
+
+	auto ReadbackStagingRing = [&](uint64 Size)
+	{
+		auto Drain = [&](int32 Slot, uint64 Offset)
+		{
+			const uint64 Bytes = FMath::Min(RingChunkBytes, Size - Offset);
+			if (MapBufferSync(Context.Device, ReadbackRing[Slot], WGPUMapMode_Read, RingChunkBytes))
+			{
+				FMemory::Memcpy(HostData.GetData() + Offset, wgpuBufferGetConstMappedRange(ReadbackRing[Slot], 0, RingChunkBytes), Bytes);
+				wgpuBufferUnmap(ReadbackRing[Slot]);
+			}
+		};
+
+		//Chunk i copies while chunk i - 1 is mapped and drained
+		int32 Slot = 0;
+		for (uint64 Offset = 0; Offset < Size; Offset += RingChunkBytes, Slot ^= 1)
+		{
+			CopyBuffer(DeviceBuffer, Offset, ReadbackRing[Slot], 0, FMath::Min(RingChunkBytes, Size - Offset));
+			if (Offset > 0)
+			{
+				Drain(Slot ^ 1, Offset - RingChunkBytes);
+			}
+		}
+		Drain(Slot ^ 1, Align(Size, RingChunkBytes) - RingChunkBytes);
+	};
+
+	auto MeasureGBs = [&](TFunctionRef<void(uint64)> Transfer, uint64 Size)
+	{
+		//Roughly 256 MB per measurement, at least one warm run first
+		const int32 Reps = (int32)FMath::Clamp<uint64>(256ull * 1024 * 1024 / Size, 1, 64);
+		Transfer(Size);
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Reps; i++)
+		{
+			Transfer(Size);
+		}
+		const double Seconds = (FPlatformTime::Seconds() - Start) / Reps;
+		return (Size / Seconds) / 1e9;
+	};
+
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Transfer] Sizes: %llu - %llu bytes, staging ring chunk: %llu KB"), MinBytes, MaxBytes, RingChunkBytes / 1024);
+
+	for (uint64 Size = MinBytes; Size <= MaxBytes; Size *= 4)
+	{
+		const double WriteBufferGBs = MeasureGBs(UploadWriteBuffer, Size);
+		const double MappedGBs = MeasureGBs(UploadMappedAtCreation, Size);
+		const double UploadRingGBs = MeasureGBs(UploadStagingRing, Size);
+		const double MapAsyncGBs = MeasureGBs(ReadbackMapAsync, Size);
+		const double ReadbackRingGBs = MeasureGBs(ReadbackStagingRing, Size);
+
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Transfer] %10llu KB: Upload WriteBuffer %.2f GB/s, MappedAtCreation %.2f GB/s, StagingRing %.2f GB/s | Readback MapAsync %.2f GB/s, StagingRing %.2f GB/s"),
+			Size / 1024, WriteBufferGBs, MappedGBs, UploadRingGBs, MapAsyncGBs, ReadbackRingGBs);
+	}
+
+	//Small round trips: upload 4 KB, read it back, per path
+	const uint64 LatencyBytes = FMath::Min<uint64>(4096, MaxBytes);
+	struct FRoundTrip
+	{
+		const TCHAR* Label;
+		TFunctionRef<void(uint64)> Upload;
+		TFunctionRef<void(uint64)> Readback;
+	};
+	const FRoundTrip RoundTrips[] = {
+		{ TEXT("WriteBuffer + MapAsync"), UploadWriteBuffer, ReadbackMapAsync },
+		{ TEXT("MappedAtCreation + MapAsync"), UploadMappedAtCreation, ReadbackMapAsync },
+		{ TEXT("StagingRing + StagingRing"), UploadStagingRing, ReadbackStagingRing },
+	};
+
+	for (const FRoundTrip& RoundTrip : RoundTrips)
+	{
+		TArray<double> Samples;
+		Samples.SetNumUninitialized(LatencyIterations);
+
+		RoundTrip.Upload(LatencyBytes);
+		RoundTrip.Readback(LatencyBytes);
+		for (double& Sample : Samples)
+		{
+			const double Start = FPlatformTime::Seconds();
+			RoundTrip.Upload(LatencyBytes);
+			RoundTrip.Readback(LatencyBytes);
+			Sample = FPlatformTime::Seconds() - Start;
+		}
+
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Transfer] %s round trip (%llu bytes): %s"),
+			RoundTrip.Label, LatencyBytes, *FBenchmarkStats::Compute(Samples).ToString(1e6, TEXT(" us")));
+	}
+
+	for (int32 i = 0; i < 2; i++)
+	{
+		wgpuBufferRelease(ReadbackRing[i]);
+		wgpuBufferRelease(UploadRing[i]);
+	}
+	wgpuBufferRelease(DeviceBuffer);
+}
+
+void FWebGPUBenchmark::BenchmarkDispatch(int32 Iterations, int32 DispatchesPerBatch)
+{
+	Iterations = FMath::Max(Iterations, 1);
+	DispatchesPerBatch = FMath::Max(DispatchesPerBatch, 1);
+
+	FWebGPUKernel Kernel;
+	if (!Kernel.Create(Context, EmptySource, { WGPUBufferBindingType_Storage }, false))
+	{
+		UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU Dispatch] Empty kernel failed to compile"));
+		return;
+	}
+
+	WGPUBuffer DataBuffer = Context.CreateBuffer(256, WGPUBufferUsage_Storage, "bench_dispatch_buffer");
+
+	//Encoder, bind group, pass and finish per job, the way RunExampleShader does it
+	TArray<double> EncodeSamples;
+	TArray<double> SubmitSamples;
+	TArray<double> WaitSamples;
+	TArray<double> TotalSamples;
+	for (int32 i = -1; i < Iterations; i++)
+	{
+		const double Start = FPlatformTime::Seconds();
+
+		WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context.Device, nullptr);
+		WGPUBindGroup BindGroup = Kernel.CreateBindGroup(TArray<WGPUBuffer>({ DataBuffer }));
+		WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+		Kernel.Dispatch(ComputePassEncoder, BindGroup, nullptr, 0, 1);
+		wgpuComputePassEncoderEnd(ComputePassEncoder);
+		wgpuComputePassEncoderRelease(ComputePassEncoder);
+		WGPUCommandBuffer CommandBuffer = wgpuCommandEncoderFinish(CommandEncoder, nullptr);
+		const double Encoded = FPlatformTime::Seconds();
+
+		wgpuQueueSubmit(Context.Queue, 1, &CommandBuffer);
+		const double Submitted = FPlatformTime::Seconds();
+
+		WaitForGPU();
+		const double Done = FPlatformTime::Seconds();
+
+		wgpuCommandBufferRelease(CommandBuffer);
+		wgpuCommandEncoderRelease(CommandEncoder);
+		wgpuBindGroupRelease(BindGroup);
+
+		//First round is warmup
+		if (i >= 0)
+		{
+			EncodeSamples.Add(Encoded - Start);
+			SubmitSamples.Add(Submitted - Encoded);
+			WaitSamples.Add(Done - Submitted);
+			TotalSamples.Add(Done - Start);
+		}
+	}
+
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Dispatch] Empty kernel round trip: %s"), *FBenchmarkStats::Compute(TotalSamples).ToString(1e6, TEXT(" us")));
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Dispatch]   encode: %s"), *FBenchmarkStats::Compute(EncodeSamples).ToString(1e6, TEXT(" us")));
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Dispatch]   submit: %s"), *FBenchmarkStats::Compute(SubmitSamples).ToString(1e6, TEXT(" us")));
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Dispatch]   wait: %s"), *FBenchmarkStats::Compute(WaitSamples).ToString(1e6, TEXT(" us")));
+
+	//Batches of DispatchesPerBatch empty dispatches, the bind group is shared in both modes
+	WGPUBindGroup BindGroup = Kernel.CreateBindGroup(TArray<WGPUBuffer>({ DataBuffer }));
+
+	auto RunBatch = [&](bool bSingleSubmit)
+	{
+		const double Start = FPlatformTime::Seconds();
+		if (bSingleSubmit)
+		{
+			WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context.Device, nullptr);
+			WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+			for (int32 d = 0; d < DispatchesPerBatch; d++)
+			{
+				Kernel.Dispatch(ComputePassEncoder, BindGroup, nullptr, 0, 1);
+			}
+			wgpuComputePassEncoderEnd(ComputePassEncoder);
+			wgpuComputePassEncoderRelease(ComputePassEncoder);
+			Context.Submit(CommandEncoder);
+		}
+		else
+		{
+			for (int32 d = 0; d < DispatchesPerBatch; d++)
+			{
+				WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context.Device, nullptr);
+				WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+				Kernel.Dispatch(ComputePassEncoder, BindGroup, nullptr, 0, 1);
+				wgpuComputePassEncoderEnd(ComputePassEncoder);
+				wgpuComputePassEncoderRelease(ComputePassEncoder);
+				Context.Submit(CommandEncoder);
+			}
+		}
+		WaitForGPU();
+		return DispatchesPerBatch / (FPlatformTime::Seconds() - Start);
+	};
+
+	for (bool bSingleSubmit : { true, false })
+	{
+		RunBatch(bSingleSubmit);
+
+		TArray<double> Rates;
+		for (int32 i = 0; i < Iterations; i++)
+		{
+			Rates.Add(RunBatch(bSingleSubmit));
+		}
+
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Dispatch] %s, %d dispatches per batch: %s"),
+			bSingleSubmit ? TEXT("Single submit") : TEXT("Submit per dispatch"), DispatchesPerBatch, *FBenchmarkStats::Compute(Rates).ToString(1e-3, TEXT("k/s")));
+	}
+
+	wgpuBindGroupRelease(BindGroup);
+
+	//Poll cost with nothing in flight, then how long a blocking poll takes to return for a submit with no work
+	TArray<double> IdlePollSamples;
+	TArray<double> WakeSamples;
+	for (int32 i = -1; i < Iterations; i++)
+	{
+		double Start = FPlatformTime::Seconds();
+		wgpuDevicePoll(Context.Device, false, nullptr);
+		const double IdlePoll = FPlatformTime::Seconds() - Start;
+
+		WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context.Device, nullptr);
+		WGPUCommandBuffer CommandBuffer = wgpuCommandEncoderFinish(CommandEncoder, nullptr);
+		Start = FPlatformTime::Seconds();
+		const WGPUSubmissionIndex Submission = wgpuQueueSubmitForIndex(Context.Queue, 1, &CommandBuffer);
+		wgpuDevicePoll(Context.Device, true, &Submission);
+		const double Wake = FPlatformTime::Seconds() - Start;
+		wgpuCommandBufferRelease(CommandBuffer);
+		wgpuCommandEncoderRelease(CommandEncoder);
+
+		if (i >= 0)
+		{
+			IdlePollSamples.Add(IdlePoll);
+			WakeSamples.Add(Wake);
+		}
+	}
+
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Dispatch] Idle poll: %s"), *FBenchmarkStats::Compute(IdlePollSamples).ToString(1e6, TEXT(" us")));
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Dispatch] Empty submit wake: %s"), *FBenchmarkStats::Compute(WakeSamples).ToString(1e6, TEXT(" us")));
+
+	wgpuBufferRelease(DataBuffer);
+}
+
+bool FWebGPUBenchmark::BenchmarkShaderCompile(int32 Iterations, float Tolerance, bool bUpdateBaseline)
+{
+	Iterations = FMath::Max(Iterations, 1);
+
+	WGPUAdapterInfo AdapterInfo = {};
+	wgpuAdapterGetInfo(Context.Adapter, &AdapterInfo);
+	const FString Backend = GetBackendName(AdapterInfo.backendType);
+	wgpuAdapterInfoFreeMembers(AdapterInfo);
+
+	const FCompileCase Cases[] = {
+		{ TEXT("Small"), FString(CompileSmallSource) },
+		{ TEXT("Loops"), FString(CompileLoopsSource) },
+		{ TEXT("Large"), MakeCompileLargeSource() },
+		{ TEXT("ManyBindings"), MakeCompileBindingsSource() },
+	};
+
+	//Cold salts only have to differ from anything the driver cached before, including earlier runs
+	uint32 ColdSalt = FPlatformTime::Cycles();
+
+	struct FCompileResult
+	{
+		FString Key;
+		FBenchmarkStats Module;
+		FBenchmarkStats Pipeline;
+	};
+	TArray<FCompileResult> Results;
+	bool bCompiled = true;
+
+	UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Compile] Backend: %s, Iterations: %d"), *Backend, Iterations);
+
+	for (const FCompileCase& Case : Cases)
+	{
+		for (bool bCold : { true, false })
+		{
+			TArray<double> ModuleSamples;
+			TArray<double> PipelineSamples;
+
+			//Cached runs compile the same source every time, the untimed first compile fills the caches
+			for (int32 i = bCold ? 0 : -1; i < Iterations; i++)
+			{
+				const uint32 Salt = bCold ? ++ColdSalt : 0;
+				const FString Source = Case.Source.Replace(TEXT("SALT"), *FString::Printf(TEXT("%u"), Salt));
+
+				const double Start = FPlatformTime::Seconds();
+				WGPUShaderModule ShaderModule = Context.CreateShaderModule(Source, "bench_compile.wgsl");
+				const double ModuleDone = FPlatformTime::Seconds();
+				WGPUComputePipeline Pipeline = ShaderModule ? Context.CreateComputePipeline(ShaderModule) : nullptr;
+				const double PipelineDone = FPlatformTime::Seconds();
+
+				if (!Pipeline)
+				{
+					bCompiled = false;
+					if (ShaderModule)
+					{
+						wgpuShaderModuleRelease(ShaderModule);
+					}
+					break;
+				}
+
+				if (i >= 0)
+				{
+					ModuleSamples.Add(ModuleDone - Start);
+					PipelineSamples.Add(PipelineDone - ModuleDone);
+				}
+
+				wgpuComputePipelineRelease(Pipeline);
+				wgpuShaderModuleRelease(ShaderModule);
+			}
+
+			if (ModuleSamples.Num() == 0)
+			{
+				UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU Compile] %s failed to compile"), Case.Name);
+				break;
+			}
+
+			FCompileResult& Result = Results.AddDefaulted_GetRef();
+			Result.Key = FString::Printf(TEXT("%s,%s"), Case.Name, bCold ? TEXT("Cold") : TEXT("Cached"));
+			Result.Module = FBenchmarkStats::Compute(ModuleSamples);
+			Result.Pipeline = FBenchmarkStats::Compute(PipelineSamples);
+
+			UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Compile] %s %s module: %s"), Case.Name, bCold ? TEXT("cold") : TEXT("cached"), *Result.Module.ToString(1e3, TEXT(" ms")));
+			UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Compile] %s %s pipeline: %s"), Case.Name, bCold ? TEXT("cold") : TEXT("cached"), *Result.Pipeline.ToString(1e3, TEXT(" ms")));
+		}
+	}
+
+	//Baseline lines: Name,Mode,ModuleP50Us,PipelineP50Us
+	const FString BaselinePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("WebGPUCompute"), FString::Printf(TEXT("CompileBaseline_%s.csv"), *Backend));
+
+	TArray<FString> BaselineLines;
+	const bool bHasBaseline = FFileHelper::LoadFileToStringArray(BaselineLines, *BaselinePath);
+
+	bool bRegressed = false;
+	if (bHasBaseline)
+	{
+		for (const FString& Line : BaselineLines)
+		{
+			TArray<FString> Fields;
+			if (Line.ParseIntoArray(Fields, TEXT(",")) != 4)
+			{
+				continue;
+			}
+
+			const FString Key = Fields[0] + TEXT(",") + Fields[1];
+			const double BaselineUs[2] = { FCString::Atod(*Fields[2]), FCString::Atod(*Fields[3]) };
+			for (const FCompileResult& Result : Results)
+			{
+				if (Result.Key != Key)
+				{
+					continue;
+				}
+
+				//Sub 100 us differences are timer noise, not regressions
+				const double CurrentUs[2] = { Result.Module.P50 * 1e6, Result.Pipeline.P50 * 1e6 };
+				const TCHAR* Stages[2] = { TEXT("module"), TEXT("pipeline") };
+				for (int32 Stage = 0; Stage < 2; Stage++)
+				{
+					if (CurrentUs[Stage] > BaselineUs[Stage] * (1.0 + Tolerance) && CurrentUs[Stage] - BaselineUs[Stage] > 100.0)
+					{
+						bRegressed = true;
+						UE_LOG(LogWebGPUBenchmark, Warning, TEXT("[GPU Compile] Regression %s %s: p50 %.0f us vs baseline %.0f us"), *Key, Stages[Stage], CurrentUs[Stage], BaselineUs[Stage]);
+					}
+				}
+			}
+		}
+
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Compile] Compared against %s: %s"), *BaselinePath, bRegressed ? TEXT("regressed") : TEXT("ok"));
+	}
+
+	if ((!bHasBaseline || bUpdateBaseline) && bCompiled)
+	{
+		FString Baseline;
+		for (const FCompileResult& Result : Results)
+		{
+			Baseline += FString::Printf(TEXT("%s,%.1f,%.1f\n"), *Result.Key, Result.Module.P50 * 1e6, Result.Pipeline.P50 * 1e6);
+		}
+		FFileHelper::SaveStringToFile(Baseline, *BaselinePath);
+		UE_LOG(LogWebGPUBenchmark, Log, TEXT("[GPU Compile] Baseline written to %s"), *BaselinePath);
+	}
+
+	return bCompiled && !bRegressed;
+}
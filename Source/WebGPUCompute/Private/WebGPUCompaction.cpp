@@ -0,0 +1,317 @@
+#include "WebGPUCompaction.h"
+#include "WebGPUContext.h"
+
+namespace
+{
+	//SCALAR_T and KEEP_SOURCE are substituted, every kernel below is appended to this block
+	const char* CompactCommonSource = (R"(
+struct Params {
+	count: u32,
+	pad0: u32,
+	pad1: u32,
+	pad2: u32,
+}
+
+const WG: u32 = 256u;
+
+@group(1) @binding(0) var<uniform> params: Params;
+
+fn keep(v: SCALAR_T, index: u32) -> bool {
+	KEEP_SOURCE
+}
+
+fn element_index(wid: vec3<u32>, nwg: vec3<u32>, lid: u32) -> u32 {
+	return (wid.y * nwg.x + wid.x) * WG + lid;
+}
+		)");
+
+	const char* FlagsSource = (R"(
+@group(0) @binding(0) var<storage, read> src: array<SCALAR_T>;
+@group(0) @binding(1) var<storage, read_write> flags: array<u32>;
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let i = element_index(wid, nwg, lid);
+	if (i < params.count) {
+		flags[i] = select(0u, 1u, keep(src[i], i));
+	}
+}
+		)");
+
+	//Scatter and finish share one layout so they share one bind group
+	const char* ScatterSource = (R"(
+@group(0) @binding(0) var<storage, read> src: array<SCALAR_T>;
+@group(0) @binding(1) var<storage, read> flags: array<u32>;
+@group(0) @binding(2) var<storage, read> offsets: array<u32>;
+@group(0) @binding(3) var<storage, read_write> dst: array<SCALAR_T>;
+@group(0) @binding(4) var<storage, read_write> counter: atomic<u32>;
+
+// the counter is only read here, finish bumps it in a later dispatch
+@compute
+@workgroup_size(256)
+fn scatter(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let i = element_index(wid, nwg, lid);
+	if (i < params.count && flags[i] != 0u) {
+		let slot = atomicLoad(&counter) + offsets[i];
+		if (slot < arrayLength(&dst)) {
+			dst[slot] = src[i];
+		}
+	}
+}
+
+@compute
+@workgroup_size(1)
+fn finish() {
+	let last = params.count - 1u;
+	atomicAdd(&counter, offsets[last] + flags[last]);
+}
+		)");
+
+	const char* AtomicSource = (R"(
+@group(0) @binding(0) var<storage, read> src: array<SCALAR_T>;
+@group(0) @binding(1) var<storage, read_write> dst: array<SCALAR_T>;
+@group(0) @binding(2) var<storage, read_write> counter: atomic<u32>;
+
+var<workgroup> local_count: atomic<u32>;
+var<workgroup> base: u32;
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let i = element_index(wid, nwg, lid);
+
+	var v: SCALAR_T;
+	var kept = false;
+	if (i < params.count) {
+		v = src[i];
+		kept = keep(v, i);
+	}
+
+	// reserve workgroup slots first, then one global atomic for the whole group
+	var slot = 0u;
+	if (kept) {
+		slot = atomicAdd(&local_count, 1u);
+	}
+	workgroupBarrier();
+
+	if (lid == 0u) {
+		let n = atomicLoad(&local_count);
+		if (n > 0u) {
+			base = atomicAdd(&counter, n);
+		}
+	}
+	workgroupBarrier();
+
+	if (kept && base + slot < arrayLength(&dst)) {
+		dst[base + slot] = v;
+	}
+}
+		)");
+}
+
+FWebGPUAppendBuffer::~FWebGPUAppendBuffer()
+{
+	Release();
+}
+
+bool FWebGPUAppendBuffer::Create(FWebGPUContext& InContext, uint32 InCapacity, uint32 InElementSize, const char* Label)
+{
+	Release();
+
+	if (InCapacity == 0 || InElementSize == 0 || InElementSize % 4 != 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Invalid append buffer: %u elements of %u bytes"), InCapacity, InElementSize);
+		return false;
+	}
+
+	Context = &InContext;
+	Capacity = InCapacity;
+	ElementSize = InElementSize;
+
+	DataBuffer = Context->CreateBuffer((uint64)Capacity * ElementSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, Label);
+	CounterBuffer = Context->CreateBuffer(sizeof(uint32), WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "append_counter_buffer");
+	ResetCount();
+	return true;
+}
+
+void FWebGPUAppendBuffer::Release()
+{
+	if (CounterBuffer)
+	{
+		wgpuBufferRelease(CounterBuffer);
+		CounterBuffer = nullptr;
+	}
+	if (DataBuffer)
+	{
+		wgpuBufferRelease(DataBuffer);
+		DataBuffer = nullptr;
+	}
+	Capacity = 0;
+	ElementSize = 0;
+	Context = nullptr;
+}
+
+void FWebGPUAppendBuffer::ResetCount()
+{
+	const uint32 Zero = 0;
+	wgpuQueueWriteBuffer(Context->Queue, CounterBuffer, 0, &Zero, sizeof(uint32));
+}
+
+uint32 FWebGPUAppendBuffer::ReadCount() const
+{
+	uint32 Count = 0;
+	if (!IsValid() || !Context->ReadBufferSync(CounterBuffer, 0, sizeof(uint32), &Count))
+	{
+		return 0;
+	}
+	return Count;
+}
+
+bool FWebGPUAppendBuffer::ReadElements(void* OutData, uint32 NumElements) const
+{
+	if (!IsValid() || NumElements > Capacity)
+	{
+		return false;
+	}
+	return NumElements == 0 || Context->ReadBufferSync(DataBuffer, 0, (uint64)NumElements * ElementSize, OutData);
+}
+
+FWebGPUCompaction::~FWebGPUCompaction()
+{
+	Release();
+}
+
+bool FWebGPUCompaction::Initialize(FWebGPUContext& InContext, EWebGPUScalarType InType, const FString& KeepSource)
+{
+	Release();
+
+	Context = &InContext;
+	Type = InType;
+
+	//Predicate goes in first so it may use SCALAR_T itself
+	const TCHAR* ScalarName = Type == EWebGPUScalarType::Float ? TEXT("f32") : Type == EWebGPUScalarType::Int32 ? TEXT("i32") : TEXT("u32");
+	auto MakeSource = [&KeepSource, ScalarName](const char* KernelSource)
+	{
+		FString Source = FString(CompactCommonSource) + FString(KernelSource);
+		Source.ReplaceInline(TEXT("KEEP_SOURCE"), *KeepSource);
+		Source.ReplaceInline(TEXT("SCALAR_T"), ScalarName);
+		return Source;
+	};
+
+	const WGPUBufferBindingType ReadOnly = WGPUBufferBindingType_ReadOnlyStorage;
+	const WGPUBufferBindingType ReadWrite = WGPUBufferBindingType_Storage;
+	const FString ScatterKernelSource = MakeSource(ScatterSource);
+
+	const bool bCreated =
+		FlagsKernel.Create(*Context, MakeSource(FlagsSource), { ReadOnly, ReadWrite }, true) &&
+		ScatterKernel.Create(*Context, ScatterKernelSource, { ReadOnly, ReadOnly, ReadOnly, ReadWrite, ReadWrite }, true, "scatter") &&
+		FinishKernel.Create(*Context, ScatterKernelSource, { ReadOnly, ReadOnly, ReadOnly, ReadWrite, ReadWrite }, true, "finish") &&
+		AtomicKernel.Create(*Context, MakeSource(AtomicSource), { ReadOnly, ReadWrite, ReadWrite }, true) &&
+		Scan.Initialize(*Context);
+
+	if (!bCreated)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Compaction kernels failed to compile, check the keep predicate"));
+		Release();
+		return false;
+	}
+	return true;
+}
+
+void FWebGPUCompaction::Release()
+{
+	FlagsKernel.Release();
+	ScatterKernel.Release();
+	FinishKernel.Release();
+	AtomicKernel.Release();
+	Scan.Release();
+
+	if (Flags)
+	{
+		wgpuBufferRelease(Flags);
+		Flags = nullptr;
+	}
+	if (Offsets)
+	{
+		wgpuBufferRelease(Offsets);
+		Offsets = nullptr;
+	}
+	FlagsCapacity = 0;
+	OffsetsCapacity = 0;
+
+	Context = nullptr;
+}
+
+bool FWebGPUCompaction::EncodeCompact(WGPUComputePassEncoder Pass, WGPUBuffer Input, uint32 Count, const FWebGPUAppendBuffer& Output, EWebGPUCompactMethod Method)
+{
+	if (!IsInitialized() || !Output.IsValid() || Output.GetElementSize() != sizeof(uint32))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Compaction needs an initialized kernel set and a 4 byte append buffer"));
+		return false;
+	}
+
+	if (Count == 0)
+	{
+		return true;
+	}
+
+	FCompactParams Params = {};
+	Params.Count = Count;
+
+	uint32 GroupsX, GroupsY;
+	Context->GetGroupCounts(FMath::DivideAndRoundUp(Count, WorkgroupSize), GroupsX, GroupsY);
+
+	if (Method == EWebGPUCompactMethod::Atomic)
+	{
+		WGPUBindGroup BindGroup = AtomicKernel.CreateBindGroup({ Input, Output.GetDataBuffer(), Output.GetCounterBuffer() });
+		const bool bDispatched = AtomicKernel.Dispatch(Pass, BindGroup, Params, GroupsX, GroupsY);
+		wgpuBindGroupRelease(BindGroup);
+		return bDispatched;
+	}
+
+	Context->EnsureScratchBuffer(Flags, FlagsCapacity, (uint64)Count * sizeof(uint32), WGPUBufferUsage_Storage, "compact_flags_buffer");
+	Context->EnsureScratchBuffer(Offsets, OffsetsCapacity, (uint64)Count * sizeof(uint32), WGPUBufferUsage_Storage, "compact_offsets_buffer");
+
+	WGPUBindGroup FlagsBindGroup = FlagsKernel.CreateBindGroup({ Input, Flags });
+	const bool bFlagged = FlagsKernel.Dispatch(Pass, FlagsBindGroup, Params, GroupsX, GroupsY);
+	wgpuBindGroupRelease(FlagsBindGroup);
+
+	if (!bFlagged || !Scan.EncodeScan(Pass, Flags, Offsets, Count, false, EWebGPUScalarType::UInt32))
+	{
+		return false;
+	}
+
+	WGPUBindGroup ScatterBindGroup = ScatterKernel.CreateBindGroup({ Input, Flags, Offsets, Output.GetDataBuffer(), Output.GetCounterBuffer() });
+	const bool bScattered = ScatterKernel.Dispatch(Pass, ScatterBindGroup, Params, GroupsX, GroupsY) &&
+		FinishKernel.Dispatch(Pass, ScatterBindGroup, Params, 1);
+	wgpuBindGroupRelease(ScatterBindGroup);
+	return bScattered;
+}
+
+bool FWebGPUCompaction::Compact(WGPUBuffer Input, uint32 Count, FWebGPUAppendBuffer& Output, EWebGPUCompactMethod Method)
+{
+	if (!IsInitialized() || !Output.IsValid())
+	{
+		return false;
+	}
+
+	Output.ResetCount();
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+	const bool bEncoded = EncodeCompact(ComputePassEncoder, Input, Count, Output, Method);
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	Context->Submit(CommandEncoder);
+	return bEncoded;
+}
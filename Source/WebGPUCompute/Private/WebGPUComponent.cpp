@@ -2,17 +2,27 @@
 #define WEBGPU_CPP_IMPLEMENTATION
 #include "webgpu/webgpu.hpp"
 #include "FlopBenchmark.h"
-
-class FWebGPUInternal
+#include "WebGPUContext.h"
+#include "WebGPUKernel.h"
+#include "WebGPUIndirectDispatch.h"
+#include "WebGPUFramePipeline.h"
+#include "WebGPUStreamingExecutor.h"
+#include "WebGPUFileJob.h"
+#include "WebGPUReduction.h"
+#include "WebGPUHistogram.h"
+#include "WebGPUFFT.h"
+#include "WebGPUCompaction.h"
+#include "WebGPUImageFilter.h"
+#include "WebGPUNoise.h"
+#include "WebGPUTextureBridge.h"
+#include "Engine/Texture2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "WebGPUBenchmark.h"
+
+class FWebGPUInternal : public FWebGPUContext
 {
 public:
 
-	struct ErrorUserData 
-	{
-		bool bDidError = false;
-	};
-	ErrorUserData AnyErrorUserData;
-
 	//We use synchronous variants because it's intended to run on a background/non-blocking thread
 	//in production (not yet implemented)
 	WGPUAdapter RequestAdapterSync(WGPUInstance instance, WGPURequestAdapterOptions const* options) 
@@ -97,11 +107,36 @@ public:
 			UE_LOG(LogTemp, Error, TEXT("Uncaught error: %s"), UTF8_TO_TCHAR(message.data));
 		};
 
+		//Ask for everything the adapter offers, the defaults cap buffers at 256MB which
+		//would force tiny chunks on large streaming jobs
+		WGPULimits AdapterLimits = {};
+		const bool bHasAdapterLimits = wgpuAdapterGetLimits(InAdapter, &AdapterLimits) == WGPUStatus_Success;
+
 		WGPUDeviceDescriptor DeviceDescriptor = {};
-		DeviceDescriptor.requiredLimits = nullptr;
+		DeviceDescriptor.requiredLimits = bHasAdapterLimits ? &AdapterLimits : nullptr;
 		//DeviceDescriptor.deviceLostCallbackInfo =	//we don't handle this case gracefully yet
 		DeviceDescriptor.uncapturedErrorCallbackInfo = UncapturedErrorCallbackInfo;
 
+		//Opt into optional features the compute helpers have fast paths for, when the adapter has them
+		const WGPUFeatureName OptionalFeatures[] = {
+			(WGPUFeatureName)WGPUNativeFeature_Subgroup,
+			WGPUFeatureName_ShaderF16,
+			WGPUFeatureName_BGRA8UnormStorage,
+			WGPUFeatureName_TimestampQuery,
+			(WGPUFeatureName)WGPUNativeFeature_ShaderF64,
+		};
+
+		TArray<WGPUFeatureName> RequiredFeatures;
+		for (WGPUFeatureName Feature : OptionalFeatures)
+		{
+			if (wgpuAdapterHasFeature(InAdapter, Feature))
+			{
+				RequiredFeatures.Add(Feature);
+			}
+		}
+		DeviceDescriptor.requiredFeatureCount = RequiredFeatures.Num();
+		DeviceDescriptor.requiredFeatures = RequiredFeatures.GetData();
+
 		wgpuAdapterRequestDevice(InAdapter, &DeviceDescriptor, CallbackInfo);
 		assert(TempDevice);
 
@@ -121,7 +156,8 @@ public:
 			UE_LOG(LogTemp, Log, TEXT(" - maxTextureDimension2D: %u"), limits.maxTextureDimension2D);
 			UE_LOG(LogTemp, Log, TEXT(" - maxTextureDimension3D: %u"), limits.maxTextureDimension3D);
 			UE_LOG(LogTemp, Log, TEXT(" - maxTextureArrayLayers: %u"), limits.maxTextureArrayLayers);
-			UE_LOG(LogTemp, Log, TEXT(" - maxBufferSize: %u"), limits.maxBufferSize);
+			UE_LOG(LogTemp, Log, TEXT(" - maxBufferSize: %llu"), limits.maxBufferSize);
+			UE_LOG(LogTemp, Log, TEXT(" - maxStorageBufferBindingSize: %llu"), limits.maxStorageBufferBindingSize);
 			UE_LOG(LogTemp, Log, TEXT(" - maxComputeWorkgroupSizeX: %u"), limits.maxComputeWorkgroupSizeX);
 			UE_LOG(LogTemp, Log, TEXT(" - maxComputeWorkgroupSizeY: %u"), limits.maxComputeWorkgroupSizeY);
 			UE_LOG(LogTemp, Log, TEXT(" - maxComputeWorkgroupSizeZ: %u"), limits.maxComputeWorkgroupSizeZ);
@@ -176,98 +212,17 @@ public:
 	void RunExampleShader(const FString& Source, const TArray<int32>& InData, TArray<int32>& OutData)
 	{
 
-		//Human readable error handling
-		ErrorUserData ErrorScopeUserData;
-
-		WGPUPopErrorScopeCallbackInfo CallbackInfo;
-		CallbackInfo.userdata1 = &ErrorScopeUserData; //todo pass through callback info for errors
-		CallbackInfo.callback = [](WGPUPopErrorScopeStatus Status,
-			WGPUErrorType ErrorType,
-			WGPUStringView Message,
-			void* UserData1,
-			void* UserData2)
-		{
-			ErrorUserData& ErrorScopeUserData = *reinterpret_cast<ErrorUserData*>(UserData1);
-			ErrorScopeUserData.bDidError = ErrorType != WGPUErrorType_NoError;
-
-			if (Message.data && ErrorScopeUserData.bDidError)
-			{
-				UE_LOG(LogTemp, Error, TEXT("%s"), UTF8_TO_TCHAR(Message.data));
-			}
-		};
-
-		//Proper way of converting FString to char*
-		FTCHARToUTF8 Converter(*Source);
-		const char* SourceBuffer = Converter.Get();
-
-		//Enabling validation catching, makes it caught here instead of uncaught on device
-		wgpuDevicePushErrorScope(Device, WGPUErrorFilter_Validation);
-		//wgpuDevicePushErrorScope(Device, WGPUErrorFilter_OutOfMemory);
-		//wgpuDevicePushErrorScope(Device, WGPUErrorFilter_Internal);
-		
-
-		WGPUShaderSourceWGSL SourceDesc = {};
-		SourceDesc.chain.next = nullptr;
-		SourceDesc.chain.sType = WGPUSType_ShaderSourceWGSL;
-
-
 		//NB: shader technically uses uint32_t, but this is compatible for early tests
 		const TArray<int32>& Numbers = InData; //{ 1, 2, 3, 4 }; //fixed data example
 		int32 NumbersSize = Numbers.Num() * sizeof(int32);
 		int32 NumbersLength = Numbers.Num();
 
-		SourceDesc.code = { SourceBuffer, WGPU_STRLEN};
-
-
-		//Top level
-		WGPUShaderModuleDescriptor ShaderDesc = {};
-		ShaderDesc.label = { "shader.wgsl", WGPU_STRLEN };
-		ShaderDesc.nextInChain = reinterpret_cast<const WGPUChainedStruct*>(&SourceDesc);
-
-		// --- Create shader module (this is the compilation call) ---
-		WGPUShaderModule ShaderModule = wgpuDeviceCreateShaderModule(Device, &ShaderDesc);
-
-		//This callback for catching compilation errors, but unfortunate doesn't work in our context
-		//WGPUCompilationInfoCallbackInfo CompilationCallbackInfo = {};
-		//CompilationCallbackInfo.nextInChain = nullptr;
-		//CompilationCallbackInfo.mode = WGPUCallbackMode_AllowSpontaneous;
-		//CompilationCallbackInfo.userdata1 = &CompilationUserData;
-		//CompilationCallbackInfo.callback = [](WGPUCompilationInfoRequestStatus status,
-		//	struct WGPUCompilationInfo const* compilationInfo,
-		//	void* userdata1, void* userdata2)
-		//{
-		//	UserData& CompilationUserData = *reinterpret_cast<UserData*>(userdata1);
-		//	CompilationUserData.bDidError = status != WGPUCompilationInfoRequestStatus_Success;
-
-		//	//for (int32 i = 0; i < compilationInfo->messageCount; i++)
-		//	//{
-		//	//	WGPUCompilationMessage message = compilationInfo->messages[i];
-		//	//	UE_LOG(LogTemp, Log, TEXT("%hs at %d"), message.message.data, message.lineNum);
-		//	//}
-		//};
-
-		//This call creates a panic, it looks like we need to capture this via error scopes
-		//wgpuShaderModuleGetCompilationInfo(ShaderModule, CompilationCallbackInfo);
-
-		//pop it here to find out if we errored on compilation
-		wgpuDevicePopErrorScope(Device, CallbackInfo);
-
-		//AnyErrorUserData or ErrorScopeUserData depending on whether error scope is set
-		if (!ShaderModule || AnyErrorUserData.bDidError || ErrorScopeUserData.bDidError)
+		WGPUShaderModule ShaderModule = CreateShaderModule(Source);
+		if (!ShaderModule)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ShaderModule Failed to compile"));
-
-			if (ShaderModule)
-			{
-				wgpuShaderModuleRelease(ShaderModule);
-			}
-
-			//Reset the error trigger for future compiles
-			AnyErrorUserData.bDidError = false;
 			return;
 		}
 
-		//wgpuDevicePopErrorScope(Device, CallbackInfo);
 		assert(ShaderModule);
 
 		// --- Create staging buffer ---
@@ -405,9 +360,453 @@ public:
 		wgpuShaderModuleRelease(ShaderModule);
 	}
 
+	//Same in/out bind as RunExampleShader, but dispatched once per parameter block. Blocks come from
+	//the frame's uniform ring and are selected by dynamic offset, so all dispatches share one bind group.
+	//Expected WGSL: @group(0) @binding(0) storage array, @group(1) @binding(0) var<uniform> params
+	void RunParameterizedShader(const FString& Source, const TArray<int32>& InData, const TArray<float>& Params, int32 ParamsPerDispatch, TArray<int32>& OutData)
+	{
+		if (ParamsPerDispatch <= 0 || Params.Num() % ParamsPerDispatch != 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Params (%d) must be a multiple of ParamsPerDispatch (%d)"), Params.Num(), ParamsPerDispatch);
+			return;
+		}
+
+		FWebGPUUniformRing& UniformRing = GetUniformRing();
+
+		const uint32 BlockSize = ParamsPerDispatch * sizeof(float);
+		const int32 DispatchCount = Params.Num() / ParamsPerDispatch;
+		const int32 NumbersSize = InData.Num() * sizeof(int32);
+		const int32 NumbersLength = InData.Num();
+
+		//All blocks are recorded into one submit, so they have to fit the ring without it wrapping onto itself
+		const uint64 FreeBlocks = UniformRing.GetFreeBlocks(BlockSize);
+		if ((uint64)DispatchCount > FreeBlocks)
+		{
+			UE_LOG(LogTemp, Error, TEXT("%d parameter blocks of %u bytes don't fit the uniform ring (%llu free), split them over several calls"),
+				DispatchCount, BlockSize, FreeBlocks);
+			return;
+		}
+
+		WGPUShaderModule ShaderModule = CreateShaderModule(Source);
+		if (!ShaderModule)
+		{
+			return;
+		}
+
+		// --- Explicit layout, auto layouts can't express dynamic offsets ---
+		WGPUBindGroupLayoutEntry StorageLayoutEntry = {};
+		StorageLayoutEntry.binding = 0;
+		StorageLayoutEntry.visibility = WGPUShaderStage_Compute;
+		StorageLayoutEntry.buffer.type = WGPUBufferBindingType_Storage;
+
+		WGPUBindGroupLayoutDescriptor StorageLayoutDesc = {};
+		StorageLayoutDesc.label = { "storage_layout", WGPU_STRLEN };
+		StorageLayoutDesc.entryCount = 1;
+		StorageLayoutDesc.entries = &StorageLayoutEntry;
+
+		WGPUBindGroupLayout StorageLayout = wgpuDeviceCreateBindGroupLayout(Device, &StorageLayoutDesc);
+		assert(StorageLayout);
+
+		WGPUBindGroupLayout GroupLayouts[2] = { StorageLayout, UniformRing.GetBindGroupLayout() };
+
+		WGPUPipelineLayoutDescriptor PipelineLayoutDesc = {};
+		PipelineLayoutDesc.label = { "parameterized_pipeline_layout", WGPU_STRLEN };
+		PipelineLayoutDesc.bindGroupLayoutCount = 2;
+		PipelineLayoutDesc.bindGroupLayouts = GroupLayouts;
+
+		WGPUPipelineLayout PipelineLayout = wgpuDeviceCreatePipelineLayout(Device, &PipelineLayoutDesc);
+		assert(PipelineLayout);
+
+		WGPUComputePipeline ComputePipeline = CreateComputePipeline(ShaderModule, PipelineLayout);
+		if (!ComputePipeline)
+		{
+			wgpuPipelineLayoutRelease(PipelineLayout);
+			wgpuBindGroupLayoutRelease(StorageLayout);
+			wgpuShaderModuleRelease(ShaderModule);
+			return;
+		}
+
+		//Only touch the ring once nothing else can fail, the blocks go up to the gpu in a single write at submit
+		TArray<uint32> DynamicOffsets;
+		DynamicOffsets.SetNumUninitialized(DispatchCount);
+		for (int32 i = 0; i < DispatchCount; i++)
+		{
+			verify(UniformRing.Allocate(&Params[i * ParamsPerDispatch], BlockSize, DynamicOffsets[i]));
+		}
+
+		WGPUBuffer StorageBuffer = CreateBuffer(NumbersSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "storage_buffer");
+
+		WGPUBindGroupEntry BindEntry = {};
+		BindEntry.binding = 0;
+		BindEntry.buffer = StorageBuffer;
+		BindEntry.offset = 0;
+		BindEntry.size = NumbersSize;
+
+		WGPUBindGroupDescriptor BindGroupDesc = {};
+		BindGroupDesc.label = { "bind_group", WGPU_STRLEN };
+		BindGroupDesc.layout = StorageLayout;
+		BindGroupDesc.entryCount = 1;
+		BindGroupDesc.entries = &BindEntry;
+
+		WGPUBindGroup BindGroup = wgpuDeviceCreateBindGroup(Device, &BindGroupDesc);
+		assert(BindGroup);
+
+		wgpuQueueWriteBuffer(Queue, StorageBuffer, 0, InData.GetData(), NumbersSize);
+
+		WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Device, nullptr);
+
+		WGPUComputePassDescriptor ComputePassDesc = {};
+		ComputePassDesc.label = { "parameterized_compute_pass", WGPU_STRLEN };
+
+		WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, &ComputePassDesc);
+
+		// --- One bind group for all dispatches, only the dynamic offset changes ---
+		wgpuComputePassEncoderSetPipeline(ComputePassEncoder, ComputePipeline);
+		wgpuComputePassEncoderSetBindGroup(ComputePassEncoder, 0, BindGroup, 0, nullptr);
+		for (uint32 DynamicOffset : DynamicOffsets)
+		{
+			wgpuComputePassEncoderSetBindGroup(ComputePassEncoder, 1, UniformRing.GetBindGroup(), 1, &DynamicOffset);
+			wgpuComputePassEncoderDispatchWorkgroups(ComputePassEncoder, NumbersLength, 1, 1);
+		}
+		wgpuComputePassEncoderEnd(ComputePassEncoder);
+		wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+		Submit(CommandEncoder);
+
+		const int32 OutStart = OutData.Num();
+		OutData.AddUninitialized(NumbersLength);
+		if (!ReadBufferSync(StorageBuffer, 0, NumbersSize, OutData.GetData() + OutStart))
+		{
+			OutData.SetNum(OutStart);
+		}
+
+		wgpuBindGroupRelease(BindGroup);
+		wgpuBufferRelease(StorageBuffer);
+		wgpuComputePipelineRelease(ComputePipeline);
+		wgpuPipelineLayoutRelease(PipelineLayout);
+		wgpuBindGroupLayoutRelease(StorageLayout);
+		wgpuShaderModuleRelease(ShaderModule);
+	}
+
+	//Producer/consumer chain where the producer decides how much work the consumer gets. Both shaders
+	//bind @binding(0) data array and @binding(1) a u32 element count (atomic in the producer). The
+	//consumer is dispatched indirectly from that count, nothing is read back until the chain is done.
+	void RunIndirectChain(const FString& ProducerSource, const FString& ConsumerSource, int32 ConsumerWorkgroupSize, const TArray<int32>& InData, TArray<int32>& OutData)
+	{
+		//Has to match the consumer's @workgroup_size, anything the device can't run would turn the count into garbage args
+		const uint32 MaxInvocations = GetLimits().maxComputeInvocationsPerWorkgroup;
+		if (ConsumerWorkgroupSize <= 0 || (uint32)ConsumerWorkgroupSize > MaxInvocations)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Consumer workgroup size %d is outside 1..%u (maxComputeInvocationsPerWorkgroup)"), ConsumerWorkgroupSize, MaxInvocations);
+			return;
+		}
+
+		if (!IndirectDispatch.IsInitialized() && !IndirectDispatch.Initialize(*this))
+		{
+			return;
+		}
+
+		const TArray<WGPUBufferBindingType> Bindings = { WGPUBufferBindingType_Storage, WGPUBufferBindingType_Storage };
+
+		FWebGPUKernel Producer;
+		FWebGPUKernel Consumer;
+		if (!Producer.Create(*this, ProducerSource, Bindings, false) || !Consumer.Create(*this, ConsumerSource, Bindings, false))
+		{
+			return;
+		}
+
+		const int32 NumbersSize = InData.Num() * sizeof(int32);
+		const uint32 ZeroCount = 0;
+
+		WGPUBuffer DataBuffer = CreateBuffer(NumbersSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "chain_data_buffer");
+		WGPUBuffer CountBuffer = CreateBuffer(sizeof(uint32), WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "chain_count_buffer");
+		WGPUBuffer ArgsBuffer = IndirectDispatch.CreateArgsBuffer();
+
+		wgpuQueueWriteBuffer(Queue, DataBuffer, 0, InData.GetData(), NumbersSize);
+		wgpuQueueWriteBuffer(Queue, CountBuffer, 0, &ZeroCount, sizeof(uint32));
+
+		WGPUBindGroup ProducerBindGroup = Producer.CreateBindGroup({ DataBuffer, CountBuffer });
+		WGPUBindGroup ConsumerBindGroup = Consumer.CreateBindGroup({ DataBuffer, CountBuffer });
+
+		WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Device, nullptr);
+		WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+		Producer.Dispatch(ComputePassEncoder, ProducerBindGroup, nullptr, 0, InData.Num());
+		const bool bEncoded = IndirectDispatch.EncodeCountToArgs(ComputePassEncoder, CountBuffer, 0, ConsumerWorkgroupSize, ArgsBuffer) &&
+			Consumer.DispatchIndirect(ComputePassEncoder, ConsumerBindGroup, nullptr, 0, ArgsBuffer, 0);
+
+		wgpuComputePassEncoderEnd(ComputePassEncoder);
+		wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+		Submit(CommandEncoder);
+
+		//Only now does the cpu need the count
+		uint32 Count = 0;
+		if (bEncoded && ReadBufferSync(CountBuffer, 0, sizeof(uint32), &Count))
+		{
+			Count = FMath::Min<uint32>(Count, InData.Num());
+			const int32 OutStart = OutData.Num();
+			OutData.AddUninitialized(Count);
+			if (Count > 0 && !ReadBufferSync(DataBuffer, 0, Count * sizeof(int32), OutData.GetData() + OutStart))
+			{
+				OutData.SetNum(OutStart);
+			}
+		}
+
+		wgpuBindGroupRelease(ConsumerBindGroup);
+		wgpuBindGroupRelease(ProducerBindGroup);
+		wgpuBufferRelease(ArgsBuffer);
+		wgpuBufferRelease(CountBuffer);
+		wgpuBufferRelease(DataBuffer);
+	}
+
+	//Uploads 4 byte elements and reduces them on the gpu, only the result comes back
+	bool ReduceArray(const void* Data, int32 Num, EWebGPUReduceOp Op, EWebGPUScalarType Type, void* OutValue, uint32& OutIndex)
+	{
+		if (Num <= 0 || (!Reduction.IsInitialized() && !Reduction.Initialize(*this)))
+		{
+			return false;
+		}
+
+		const uint64 DataSize = (uint64)Num * sizeof(uint32);
+		WGPUBuffer InputBuffer = CreateBuffer(DataSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "reduce_input_buffer");
+		wgpuQueueWriteBuffer(Queue, InputBuffer, 0, Data, DataSize);
+
+		const bool bSuccess = Reduction.Reduce(InputBuffer, Num, Op, Type, OutValue, Op == EWebGPUReduceOp::ArgMax ? &OutIndex : nullptr);
+
+		wgpuBufferRelease(InputBuffer);
+		return bSuccess;
+	}
+
+	//Uploads 4 byte elements and bins them on the gpu, only the bins come back
+	bool HistogramArray(const void* Data, int32 Num, EWebGPUScalarType Type, int32 NumBins, double MinValue, double MaxValue, TArray<uint32>& OutBins)
+	{
+		if (Num <= 0 || NumBins <= 0 || (!Histogram.IsInitialized() && !Histogram.Initialize(*this)))
+		{
+			return false;
+		}
+
+		const uint64 DataSize = (uint64)Num * sizeof(uint32);
+		WGPUBuffer InputBuffer = CreateBuffer(DataSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "histogram_input_buffer");
+		wgpuQueueWriteBuffer(Queue, InputBuffer, 0, Data, DataSize);
+
+		const bool bSuccess = Histogram.Histogram(InputBuffer, Num, Type, NumBins, MinValue, MaxValue, OutBins);
+
+		wgpuBufferRelease(InputBuffer);
+		return bSuccess;
+	}
+
+	//RunExampleShader bind and dispatch, then the 0xffffffff sentinels are compacted away on the gpu
+	//in the same pass. Only the survivors and their count are read back.
+	bool RunCompactedShader(const FString& Source, const TArray<int32>& InData, bool bPreserveOrder, TArray<int32>& OutData)
+	{
+		if (InData.Num() == 0 || (!Compaction.IsInitialized() && !Compaction.Initialize(*this)))
+		{
+			return false;
+		}
+
+		FWebGPUKernel Kernel;
+		if (!Kernel.Create(*this, Source, { WGPUBufferBindingType_Storage }, false))
+		{
+			return false;
+		}
+
+		FWebGPUAppendBuffer Survivors;
+		if (!Survivors.Create(*this, InData.Num(), sizeof(int32), "compacted_buffer"))
+		{
+			return false;
+		}
+
+		const int32 NumbersSize = InData.Num() * sizeof(int32);
+		WGPUBuffer StorageBuffer = CreateBuffer(NumbersSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "storage_buffer");
+		wgpuQueueWriteBuffer(Queue, StorageBuffer, 0, InData.GetData(), NumbersSize);
+
+		WGPUBindGroup BindGroup = Kernel.CreateBindGroup({ StorageBuffer });
+
+		WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Device, nullptr);
+		WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+		Kernel.Dispatch(ComputePassEncoder, BindGroup, nullptr, 0, InData.Num());
+		const bool bEncoded = Compaction.EncodeCompact(ComputePassEncoder, StorageBuffer, InData.Num(), Survivors,
+			bPreserveOrder ? EWebGPUCompactMethod::Scan : EWebGPUCompactMethod::Atomic);
+
+		wgpuComputePassEncoderEnd(ComputePassEncoder);
+		wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+		Submit(CommandEncoder);
+
+		const bool bSuccess = bEncoded && Survivors.ReadBack(OutData);
+
+		wgpuBindGroupRelease(BindGroup);
+		wgpuBufferRelease(StorageBuffer);
+		return bSuccess;
+	}
+
+	//Input texture at @binding(0) (texture_2d), render target sized write-only storage texture at @binding(1).
+	//The shader is dispatched in 8x8 tiles over the output, the result lands in the render target.
+	bool RunTextureShaderOnTarget(const FString& Source, UTexture* Input, UTextureRenderTarget2D* Output)
+	{
+		if (!Input || !Output)
+		{
+			return false;
+		}
+
+		FWebGPUTextureBridge Bridge(*this);
+		FWebGPUTexture InputTexture;
+		FWebGPUTexture OutputTexture;
+
+		bool bUploaded = false;
+		if (UTexture2D* Texture2D = Cast<UTexture2D>(Input))
+		{
+			bUploaded = Bridge.UploadTexture2D(Texture2D, InputTexture);
+		}
+		else if (UTextureRenderTarget2D* RenderTarget = Cast<UTextureRenderTarget2D>(Input))
+		{
+			bUploaded = Bridge.UploadRenderTarget(RenderTarget, InputTexture);
+		}
+
+		const WGPUTextureFormat OutputFormat = FWebGPUTextureBridge::ToWGPUFormat(Output->GetFormat());
+		if (!bUploaded || !Bridge.SupportsStorage(OutputFormat) || !Bridge.CreateTexture(Output->SizeX, Output->SizeY, OutputFormat, OutputTexture))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("RunTextureShader: unsupported input texture or render target format"));
+			InputTexture.Release();
+			return false;
+		}
+
+		TArray<WGPUBindGroupLayoutEntry> LayoutEntries;
+		LayoutEntries.SetNumZeroed(2);
+		LayoutEntries[0].binding = 0;
+		LayoutEntries[0].visibility = WGPUShaderStage_Compute;
+		LayoutEntries[0].texture.sampleType = FWebGPUTextureBridge::GetSampleType(InputTexture.Format);
+		LayoutEntries[0].texture.viewDimension = WGPUTextureViewDimension_2D;
+		LayoutEntries[1].binding = 1;
+		LayoutEntries[1].visibility = WGPUShaderStage_Compute;
+		LayoutEntries[1].storageTexture.access = WGPUStorageTextureAccess_WriteOnly;
+		LayoutEntries[1].storageTexture.format = OutputFormat;
+		LayoutEntries[1].storageTexture.viewDimension = WGPUTextureViewDimension_2D;
+
+		bool bSuccess = false;
+		FWebGPUKernel Kernel;
+		if (Kernel.CreateWithLayout(*this, Source, LayoutEntries, false))
+		{
+			TArray<WGPUBindGroupEntry> Entries;
+			Entries.SetNumZeroed(2);
+			Entries[0].binding = 0;
+			Entries[0].textureView = InputTexture.View;
+			Entries[1].binding = 1;
+			Entries[1].textureView = OutputTexture.View;
+
+			WGPUBindGroup BindGroup = Kernel.CreateBindGroup(Entries);
+
+			WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Device, nullptr);
+			WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+			Kernel.Dispatch(ComputePassEncoder, BindGroup, nullptr, 0, FMath::DivideAndRoundUp(OutputTexture.Width, 8u), FMath::DivideAndRoundUp(OutputTexture.Height, 8u));
+
+			wgpuComputePassEncoderEnd(ComputePassEncoder);
+			wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+			Submit(CommandEncoder);
+			wgpuBindGroupRelease(BindGroup);
+
+			bSuccess = Bridge.ReadbackToRenderTarget(OutputTexture, Output);
+		}
+
+		OutputTexture.Release();
+		InputTexture.Release();
+		return bSuccess;
+	}
+
+	//Uploads a Width x Height f32 image, blurs it in place on the gpu and reads it back
+	bool BlurImageArray(const TArray<float>& Data, int32 Width, int32 Height, float Sigma, bool bBox, TArray<float>& OutData)
+	{
+		if (Width <= 0 || Height <= 0 || Data.Num() != Width * Height || (!ImageFilter.IsInitialized() && !ImageFilter.Initialize(*this)))
+		{
+			return false;
+		}
+
+		const uint64 DataSize = (uint64)Data.Num() * sizeof(float);
+		WGPUBuffer ImageBuffer = CreateBuffer(DataSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "image_buffer");
+		wgpuQueueWriteBuffer(Queue, ImageBuffer, 0, Data.GetData(), DataSize);
+
+		const FWebGPUImage Image = FWebGPUImage::FromBuffer(ImageBuffer);
+
+		WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Device, nullptr);
+		WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+		bool bSuccess = bBox ?
+			ImageFilter.EncodeBoxBlur(ComputePassEncoder, Image, Image, Width, Height, (uint32)FMath::Max(FMath::RoundToInt(Sigma), 0)) :
+			ImageFilter.EncodeGaussianBlur(ComputePassEncoder, Image, Image, Width, Height, Sigma);
+
+		wgpuComputePassEncoderEnd(ComputePassEncoder);
+		wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+		Submit(CommandEncoder);
+
+		if (bSuccess)
+		{
+			OutData.SetNumUninitialized(Data.Num());
+			bSuccess = ReadBufferSync(ImageBuffer, 0, DataSize, OutData.GetData());
+		}
+
+		wgpuBufferRelease(ImageBuffer);
+		return bSuccess;
+	}
+
+	bool GenerateNoiseArray(int32 Width, int32 Height, const FWebGPUNoiseSettings& Settings, TArray<float>& OutData)
+	{
+		if (Width <= 0 || Height <= 0 || (!Noise.IsInitialized() && !Noise.Initialize(*this)))
+		{
+			return false;
+		}
+
+		return Noise.Fill(Width, Height, Settings, OutData);
+	}
+
+	//Uploads interleaved float2 data, transforms it (2D when Height > 1) and reads the result back
+	bool FFTArray(const TArray<float>& Data, int32 Width, int32 Height, bool bInverse, TArray<float>& OutData)
+	{
+		const int32 SignalSize = Width * FMath::Max(Height, 1);
+		if (Width < 2 || SignalSize <= 0 || Data.Num() == 0 || Data.Num() % (SignalSize * 2) != 0 ||
+			(!FFT.IsInitialized() && !FFT.Initialize(*this)))
+		{
+			return false;
+		}
+
+		const uint32 Batch = Data.Num() / (SignalSize * 2);
+		const uint64 DataSize = (uint64)Data.Num() * sizeof(float);
+		WGPUBuffer InputBuffer = CreateBuffer(DataSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "fft_input_buffer");
+		WGPUBuffer OutputBuffer = CreateBuffer(DataSize, WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc, "fft_output_buffer");
+		wgpuQueueWriteBuffer(Queue, InputBuffer, 0, Data.GetData(), DataSize);
+
+		bool bSuccess = Height > 1 ?
+			FFT.FFT2D(InputBuffer, OutputBuffer, Width, Height, Batch, bInverse) :
+			FFT.FFT1D(InputBuffer, OutputBuffer, Width, Batch, bInverse);
+
+		if (bSuccess)
+		{
+			OutData.SetNumUninitialized(Data.Num());
+			bSuccess = ReadBufferSync(OutputBuffer, 0, DataSize, OutData.GetData());
+		}
+
+		wgpuBufferRelease(OutputBuffer);
+		wgpuBufferRelease(InputBuffer);
+		return bSuccess;
+	}
+
 	//release all memories used
 	void Shutdown()
 	{
+		Noise.Release();
+		ImageFilter.Release();
+		Compaction.Release();
+		FFT.Release();
+		Histogram.Release();
+		Reduction.Release();
+		FramePipeline.Release();
+		IndirectDispatch.Release();
+		UniformRing.Release();
+
 		if (Queue)
 		{
 			wgpuQueueRelease(Queue);
@@ -435,11 +834,22 @@ public:
 		return Instance != nullptr;
 	}
 
-	WGPUInstance Instance = nullptr;
-	WGPUAdapter Adapter = nullptr;
-	WGPUDevice Device = nullptr;
-	WGPUQueue Queue = nullptr;
-	
+	FWebGPUIndirectDispatch IndirectDispatch;
+
+	//Pipelined per-frame mode, results surface in TickComponent
+	FWebGPUFramePipeline FramePipeline;
+
+	//Built-in reduction kernels, compiled on first use
+	FWebGPUReduction Reduction;
+	FWebGPUHistogram Histogram;
+	FWebGPUFFT FFT;
+
+	//Drops the 0xffffffff sentinel
+	FWebGPUCompaction Compaction;
+
+	FWebGPUImageFilter ImageFilter;
+	FWebGPUNoise Noise;
+
 };
 
 UWebGPUComponent::UWebGPUComponent(const FObjectInitializer& ObjectInitializer)
@@ -468,6 +878,22 @@ void UWebGPUComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	// Per-frame logic
+	if (Internal->HasStarted())
+	{
+		Internal->UniformRing.BeginFrame();
+
+		if (Internal->FramePipeline.IsInitialized())
+		{
+			Internal->FramePipeline.Tick();
+
+			int64 FrameIndex = INDEX_NONE;
+			if (Internal->FramePipeline.ConsumeNewResult(LatestPipelinedResult, FrameIndex))
+			{
+				LatestPipelinedFrame = FrameIndex;
+				OnPipelinedResult.Broadcast(LatestPipelinedResult, LatestPipelinedFrame);
+			}
+		}
+	}
 }
 
 
@@ -477,16 +903,7 @@ void UWebGPUComponent::Test()
 
 	//From: https://eliemichel.github.io/LearnWebGPU/getting-started/hello-webgpu.html#lit-6
 
-	if (!Internal->HasStarted())
-	{
-		Internal->Startup();
-
-		// Display the object (WGPUInstance is a simple pointer, it may be
-		// copied around without worrying about its size).
-		UE_LOG(LogTemp, Log, TEXT("WGPU instance: %p"), Internal->Instance);
-
-		Internal->InspectAdapter(Internal->Adapter);
-	}
+	EnsureStarted();
 
 	const char* RawSource = (R"(
 @group(0)
@@ -538,6 +955,230 @@ fn main(@builtin(global_invocation_id) global_id: vec3<u32>) {
 }
 
 void UWebGPUComponent::RunShader(const FString& ShaderSource, const TArray<int32>& InData, TArray<int32>& OutData)
+{
+	EnsureStarted();
+
+	Internal->RunExampleShader(ShaderSource, InData, OutData);
+}
+
+void UWebGPUComponent::RunShaderWithParams(const FString& ShaderSource, const TArray<int32>& InData, const TArray<float>& Params, int32 ParamsPerDispatch, TArray<int32>& OutData)
+{
+	EnsureStarted();
+
+	Internal->RunParameterizedShader(ShaderSource, InData, Params, ParamsPerDispatch, OutData);
+}
+
+void UWebGPUComponent::RunShaderChainIndirect(const FString& ProducerSource, const FString& ConsumerSource, int32 ConsumerWorkgroupSize, const TArray<int32>& InData, TArray<int32>& OutData)
+{
+	EnsureStarted();
+
+	Internal->RunIndirectChain(ProducerSource, ConsumerSource, ConsumerWorkgroupSize, InData, OutData);
+}
+
+bool UWebGPUComponent::StartPipelinedShader(const FString& ShaderSource, int32 FramesInFlight)
+{
+	EnsureStarted();
+
+	LatestPipelinedResult.Reset();
+	LatestPipelinedFrame = INDEX_NONE;
+
+	return Internal->FramePipeline.Initialize(*Internal, ShaderSource, FramesInFlight);
+}
+
+void UWebGPUComponent::StopPipelinedShader()
+{
+	Internal->FramePipeline.Release();
+}
+
+bool UWebGPUComponent::SubmitPipelinedFrame(const TArray<int32>& InData)
+{
+	if (!Internal->FramePipeline.IsInitialized())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SubmitPipelinedFrame called before StartPipelinedShader"));
+		return false;
+	}
+
+	return Internal->FramePipeline.Submit(InData);
+}
+
+bool UWebGPUComponent::GetLatestPipelinedResult(TArray<int32>& OutData, int64& FrameIndex) const
+{
+	if (LatestPipelinedFrame == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutData = LatestPipelinedResult;
+	FrameIndex = LatestPipelinedFrame;
+	return true;
+}
+
+bool UWebGPUComponent::RunShaderStreamed(const FString& ShaderSource, const TArray<int32>& InData, TArray<int32>& OutData, int64 MaxChunkBytes)
+{
+	EnsureStarted();
+
+	FWebGPUStreamingExecutor Executor;
+	if (!Executor.Initialize(*Internal, ShaderSource, 64, FMath::Max<int64>(MaxChunkBytes, 0)))
+	{
+		return false;
+	}
+
+	const uint8* Source = reinterpret_cast<const uint8*>(InData.GetData());
+	const int32 OutStart = OutData.Num();
+	OutData.AddUninitialized(InData.Num());
+	uint8* Destination = reinterpret_cast<uint8*>(OutData.GetData() + OutStart);
+
+	const bool bSuccess = Executor.Run((uint64)InData.Num() * sizeof(int32), sizeof(int32),
+		[Source](uint64 Offset, void* Dst, uint64 Size)
+		{
+			FMemory::Memcpy(Dst, Source + Offset, Size);
+		},
+		[Destination](uint64 Offset, const void* Src, uint64 Size)
+		{
+			FMemory::Memcpy(Destination + Offset, Src, Size);
+		});
+
+	if (!bSuccess)
+	{
+		OutData.SetNum(OutStart);
+	}
+	return bSuccess;
+}
+
+bool UWebGPUComponent::RunShaderOnFile(const FString& ShaderSource, const FString& InputPath, const FString& OutputPath, int64 MaxChunkBytes)
+{
+	EnsureStarted();
+
+	FWebGPUFileJob Job;
+	if (!Job.Initialize(*Internal, ShaderSource, 64, FMath::Max<int64>(MaxChunkBytes, 0)))
+	{
+		return false;
+	}
+
+	return Job.Run(InputPath, OutputPath);
+}
+
+bool UWebGPUComponent::RunShaderCompacted(const FString& ShaderSource, const TArray<int32>& InData, TArray<int32>& OutData, bool bPreserveOrder)
+{
+	EnsureStarted();
+
+	return Internal->RunCompactedShader(ShaderSource, InData, bPreserveOrder, OutData);
+}
+
+bool UWebGPUComponent::ReduceFloats(const TArray<float>& InData, EWebGPUReduceOp Op, float& OutValue, int32& OutIndex)
+{
+	EnsureStarted();
+
+	uint32 Index = 0;
+	const bool bSuccess = Internal->ReduceArray(InData.GetData(), InData.Num(), Op, EWebGPUScalarType::Float, &OutValue, Index);
+	OutIndex = bSuccess && Op == EWebGPUReduceOp::ArgMax ? (int32)Index : INDEX_NONE;
+	return bSuccess;
+}
+
+bool UWebGPUComponent::ReduceInts(const TArray<int32>& InData, EWebGPUReduceOp Op, bool bUnsigned, int32& OutValue, int32& OutIndex)
+{
+	EnsureStarted();
+
+	uint32 Index = 0;
+	const bool bSuccess = Internal->ReduceArray(InData.GetData(), InData.Num(), Op, bUnsigned ? EWebGPUScalarType::UInt32 : EWebGPUScalarType::Int32, &OutValue, Index);
+	OutIndex = bSuccess && Op == EWebGPUReduceOp::ArgMax ? (int32)Index : INDEX_NONE;
+	return bSuccess;
+}
+
+bool UWebGPUComponent::HistogramFloats(const TArray<float>& InData, int32 NumBins, float MinValue, float MaxValue, TArray<int32>& OutBins)
+{
+	EnsureStarted();
+
+	TArray<uint32> Bins;
+	if (!Internal->HistogramArray(InData.GetData(), InData.Num(), EWebGPUScalarType::Float, NumBins, MinValue, MaxValue, Bins))
+	{
+		return false;
+	}
+
+	OutBins.SetNumUninitialized(Bins.Num());
+	FMemory::Memcpy(OutBins.GetData(), Bins.GetData(), Bins.Num() * sizeof(uint32));
+	return true;
+}
+
+bool UWebGPUComponent::HistogramInts(const TArray<int32>& InData, int32 NumBins, int32 MinValue, int32 MaxValue, TArray<int32>& OutBins)
+{
+	EnsureStarted();
+
+	TArray<uint32> Bins;
+	if (!Internal->HistogramArray(InData.GetData(), InData.Num(), EWebGPUScalarType::Int32, NumBins, MinValue, MaxValue, Bins))
+	{
+		return false;
+	}
+
+	OutBins.SetNumUninitialized(Bins.Num());
+	FMemory::Memcpy(OutBins.GetData(), Bins.GetData(), Bins.Num() * sizeof(uint32));
+	return true;
+}
+
+bool UWebGPUComponent::RunTextureShader(const FString& ShaderSource, UTexture* InputTexture, UTextureRenderTarget2D* OutputTarget)
+{
+	EnsureStarted();
+
+	return Internal->RunTextureShaderOnTarget(ShaderSource, InputTexture, OutputTarget);
+}
+
+bool UWebGPUComponent::BlurImage(const TArray<float>& InData, int32 Width, int32 Height, float Sigma, TArray<float>& OutData, bool bBoxBlur)
+{
+	EnsureStarted();
+
+	return Internal->BlurImageArray(InData, Width, Height, Sigma, bBoxBlur, OutData);
+}
+
+bool UWebGPUComponent::GenerateNoise(int32 Width, int32 Height, EWebGPUNoiseType NoiseType, int32 Seed, float Frequency, int32 Octaves, float WarpStrength, FVector2D Origin, TArray<float>& OutData)
+{
+	EnsureStarted();
+
+	FWebGPUNoiseSettings Settings;
+	Settings.Type = NoiseType;
+	Settings.Seed = (uint32)Seed;
+	Settings.Frequency = Frequency;
+	Settings.Octaves = Octaves;
+	Settings.WarpStrength = WarpStrength;
+	Settings.OriginX = (float)Origin.X;
+	Settings.OriginY = (float)Origin.Y;
+
+	return Internal->GenerateNoiseArray(Width, Height, Settings, OutData);
+}
+
+bool UWebGPUComponent::FFTComplex(const TArray<FVector2D>& InData, int32 Width, int32 Height, bool bInverse, TArray<FVector2D>& OutData)
+{
+	EnsureStarted();
+
+	TArray<float> Interleaved;
+	Interleaved.SetNumUninitialized(InData.Num() * 2);
+	for (int32 i = 0; i < InData.Num(); i++)
+	{
+		Interleaved[i * 2] = (float)InData[i].X;
+		Interleaved[i * 2 + 1] = (float)InData[i].Y;
+	}
+
+	TArray<float> Result;
+	if (!Internal->FFTArray(Interleaved, Width, Height, bInverse, Result))
+	{
+		return false;
+	}
+
+	OutData.SetNumUninitialized(InData.Num());
+	for (int32 i = 0; i < InData.Num(); i++)
+	{
+		OutData[i] = FVector2D(Result[i * 2], Result[i * 2 + 1]);
+	}
+	return true;
+}
+
+FWebGPUContext* UWebGPUComponent::GetWebGPUContext()
+{
+	EnsureStarted();
+
+	return Internal->HasStarted() ? Internal : nullptr;
+}
+
+void UWebGPUComponent::EnsureStarted()
 {
 	if (!Internal->HasStarted())
 	{
@@ -549,8 +1190,6 @@ void UWebGPUComponent::RunShader(const FString& ShaderSource, const TArray<int32
 
 		Internal->InspectAdapter(Internal->Adapter);
 	}
-
-	Internal->RunExampleShader(ShaderSource, InData, OutData);
 }
 
 
@@ -561,7 +1200,7 @@ void UWebGPUComponent::PrintCPUInfo()
 	Bench.PrintCPUIDInfo();
 }
 
-void UWebGPUComponent::BenchmarkFlops(int32 Threads, int64 Iterations, bool bTestAVX, bool bAVX512)
+void UWebGPUComponent::BenchmarkFlops(int32 Threads, int64 Iterations, bool bTestAVX, bool bAVX512, bool bCompareGPU, bool bLatency, int32 GPUIterations)
 {
 	FFlopBenchmark Bench;
 
@@ -569,16 +1208,119 @@ void UWebGPUComponent::BenchmarkFlops(int32 Threads, int64 Iterations, bool bTes
 	{
 		if (bAVX512)
 		{
-			Bench.BenchmarkAVX512(Iterations);
+			Bench.BenchmarkAVX512(Iterations, bLatency);
 		}
 		else
 		{
-			Bench.BenchmarkAVX2(Iterations);
+			Bench.BenchmarkAVX2(Iterations, bLatency);
 		}
 	}
 	else
 	{
-		Bench.BenchmarkCPUScalar(Threads, Iterations);
+		Bench.BenchmarkCPUScalar(Threads, Iterations, bLatency);
+	}
+
+	if (bCompareGPU)
+	{
+		EnsureStarted();
+
+		FWebGPUBenchmark GPUBench(*Internal);
+
+		GPUBench.BenchmarkFlops(GPUIterations);
+	}
+}
+
+void UWebGPUComponent::BenchmarkScaling(int32 MaxThreads, int64 Iterations, bool bVector, bool bPinThreads)
+{
+	FFlopBenchmark Bench;
+	Bench.Harness.bPinThreads = bPinThreads;
+
+	Bench.BenchmarkScaling(MaxThreads, Iterations, bVector);
+}
+
+void UWebGPUComponent::BenchmarkBandwidth(int32 Threads, int64 MinBytes, int64 MaxBytes, bool bNonTemporal, bool bCompareGPU)
+{
+	FFlopBenchmark Bench;
+
+	const int32 ThreadCount = Threads > 0 ? Threads : FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	Bench.BenchmarkBandwidth(ThreadCount, (uint64)FMath::Max<int64>(MinBytes, 0), (uint64)FMath::Max<int64>(MaxBytes, 0), bNonTemporal);
+
+	if (bCompareGPU)
+	{
+		EnsureStarted();
+
+		FWebGPUBenchmark GPUBench(*Internal);
+
+		GPUBench.BenchmarkBandwidth((uint64)FMath::Max<int64>(MinBytes, 0), (uint64)FMath::Max<int64>(MaxBytes, 0));
 	}
-	
+}
+
+void UWebGPUComponent::BenchmarkLatency(int64 MinBytes, int64 MaxBytes)
+{
+	FFlopBenchmark Bench;
+
+	Bench.BenchmarkLatency((uint64)FMath::Max<int64>(MinBytes, 0), (uint64)FMath::Max<int64>(MaxBytes, 0));
+}
+
+void UWebGPUComponent::BenchmarkTransfer(int64 MinBytes, int64 MaxBytes, int32 LatencyIterations)
+{
+	EnsureStarted();
+
+	FWebGPUBenchmark Bench(*Internal);
+
+	Bench.BenchmarkTransfer((uint64)FMath::Max<int64>(MinBytes, 0), (uint64)FMath::Max<int64>(MaxBytes, 0), LatencyIterations);
+}
+
+void UWebGPUComponent::BenchmarkDispatch(int32 Iterations, int32 DispatchesPerBatch)
+{
+	EnsureStarted();
+
+	FWebGPUBenchmark Bench(*Internal);
+
+	Bench.BenchmarkDispatch(Iterations, DispatchesPerBatch);
+}
+
+bool UWebGPUComponent::BenchmarkShaderCompile(int32 Iterations, float Tolerance, bool bUpdateBaseline)
+{
+	EnsureStarted();
+
+	FWebGPUBenchmark Bench(*Internal);
+
+	return Bench.BenchmarkShaderCompile(Iterations, Tolerance, bUpdateBaseline);
+}
+
+void UWebGPUComponent::BenchmarkScan(int32 NumElements, int32 Iterations)
+{
+	EnsureStarted();
+
+	FWebGPUBenchmark Bench(*Internal);
+
+	Bench.BenchmarkScan(NumElements, Iterations);
+}
+
+void UWebGPUComponent::BenchmarkRadixSort(int32 NumKeys, int32 Iterations)
+{
+	EnsureStarted();
+
+	FWebGPUBenchmark Bench(*Internal);
+
+	Bench.BenchmarkRadixSort(NumKeys, Iterations);
+}
+
+void UWebGPUComponent::BenchmarkGemm(int32 Size, int32 Iterations, bool bFloat16)
+{
+	EnsureStarted();
+
+	FWebGPUBenchmark Bench(*Internal);
+
+	Bench.BenchmarkGemm(Size, Iterations, bFloat16);
+}
+
+void UWebGPUComponent::BenchmarkNoise(int32 TileSize, int32 Iterations, int32 Octaves)
+{
+	EnsureStarted();
+
+	FWebGPUBenchmark Bench(*Internal);
+
+	Bench.BenchmarkNoise(TileSize, Iterations, Octaves);
 }
\ No newline at end of file
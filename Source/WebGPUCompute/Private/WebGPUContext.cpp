@@ -0,0 +1,219 @@
+#include "WebGPUContext.h"
+
+WGPUShaderModule FWebGPUContext::CreateShaderModule(const FString& Source, const char* Label)
+{
+	//Human readable error handling
+	ErrorUserData ErrorScopeUserData;
+
+	WGPUPopErrorScopeCallbackInfo CallbackInfo = {};
+	CallbackInfo.userdata1 = &ErrorScopeUserData;
+	CallbackInfo.callback = [](WGPUPopErrorScopeStatus Status,
+		WGPUErrorType ErrorType,
+		WGPUStringView Message,
+		void* UserData1,
+		void* UserData2)
+	{
+		ErrorUserData& ErrorScopeUserData = *reinterpret_cast<ErrorUserData*>(UserData1);
+		ErrorScopeUserData.bDidError = ErrorType != WGPUErrorType_NoError;
+
+		if (Message.data && ErrorScopeUserData.bDidError)
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s"), UTF8_TO_TCHAR(Message.data));
+		}
+	};
+
+	//Proper way of converting FString to char*
+	FTCHARToUTF8 Converter(*Source);
+	const char* SourceBuffer = Converter.Get();
+
+	//Enabling validation catching, makes it caught here instead of uncaught on device
+	wgpuDevicePushErrorScope(Device, WGPUErrorFilter_Validation);
+
+	WGPUShaderSourceWGSL SourceDesc = {};
+	SourceDesc.chain.next = nullptr;
+	SourceDesc.chain.sType = WGPUSType_ShaderSourceWGSL;
+	SourceDesc.code = { SourceBuffer, WGPU_STRLEN };
+
+	WGPUShaderModuleDescriptor ShaderDesc = {};
+	ShaderDesc.label = { Label, WGPU_STRLEN };
+	ShaderDesc.nextInChain = reinterpret_cast<const WGPUChainedStruct*>(&SourceDesc);
+
+	// --- Create shader module (this is the compilation call) ---
+	WGPUShaderModule ShaderModule = wgpuDeviceCreateShaderModule(Device, &ShaderDesc);
+
+	//wgpuShaderModuleGetCompilationInfo panics in our context, error scopes are the way to catch failures
+	wgpuDevicePopErrorScope(Device, CallbackInfo);
+
+	//AnyErrorUserData or ErrorScopeUserData depending on whether error scope is set
+	if (!ShaderModule || AnyErrorUserData.bDidError || ErrorScopeUserData.bDidError)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ShaderModule Failed to compile"));
+
+		if (ShaderModule)
+		{
+			wgpuShaderModuleRelease(ShaderModule);
+		}
+
+		//Reset the error trigger for future compiles
+		AnyErrorUserData.bDidError = false;
+		return nullptr;
+	}
+
+	return ShaderModule;
+}
+
+WGPUComputePipeline FWebGPUContext::CreateComputePipeline(WGPUShaderModule ShaderModule, WGPUPipelineLayout Layout, const char* EntryPoint, const TArray<WGPUConstantEntry>& Constants)
+{
+	WGPUProgrammableStageDescriptor StageDesc = {};
+	StageDesc.module = ShaderModule;
+	StageDesc.entryPoint = { EntryPoint, WGPU_STRLEN };
+	StageDesc.constantCount = Constants.Num();
+	StageDesc.constants = Constants.GetData();
+
+	WGPUComputePipelineDescriptor PipelineDesc = {};
+	PipelineDesc.label = { "compute_pipeline", WGPU_STRLEN };
+	PipelineDesc.layout = Layout;
+	PipelineDesc.compute = StageDesc;
+
+	WGPUComputePipeline ComputePipeline = wgpuDeviceCreateComputePipeline(Device, &PipelineDesc);
+	if (!ComputePipeline)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to create compute pipeline for entry point %hs"), EntryPoint);
+	}
+	return ComputePipeline;
+}
+
+WGPUBuffer FWebGPUContext::CreateBuffer(uint64 Size, WGPUBufferUsage Usage, const char* Label)
+{
+	WGPUBufferDescriptor BufferDesc = {};
+	BufferDesc.label = { Label, WGPU_STRLEN };
+	BufferDesc.usage = Usage;
+	BufferDesc.size = Size;
+	BufferDesc.mappedAtCreation = false;
+
+	WGPUBuffer Buffer = wgpuDeviceCreateBuffer(Device, &BufferDesc);
+	assert(Buffer);
+	return Buffer;
+}
+
+bool FWebGPUContext::ReadBufferSync(WGPUBuffer Buffer, uint64 Offset, uint64 Size, void* OutData)
+{
+	WGPUBuffer StagingBuffer = CreateBuffer(Size, WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst, "readback_staging_buffer");
+
+	WGPUCommandEncoderDescriptor EncoderDesc = {};
+	EncoderDesc.label = { "readback_encoder", WGPU_STRLEN };
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Device, &EncoderDesc);
+	wgpuCommandEncoderCopyBufferToBuffer(CommandEncoder, Buffer, Offset, StagingBuffer, 0, Size);
+
+	WGPUCommandBuffer CommandBuffer = wgpuCommandEncoderFinish(CommandEncoder, nullptr);
+	wgpuQueueSubmit(Queue, 1, &CommandBuffer);
+
+	bool bMapped = false;
+
+	WGPUBufferMapCallbackInfo ReadMapInfo = {};
+	ReadMapInfo.userdata1 = &bMapped;
+	ReadMapInfo.callback = [](WGPUMapAsyncStatus Status, WGPUStringView Message, void* UserData1, void* UserData2)
+	{
+		*reinterpret_cast<bool*>(UserData1) = Status == WGPUMapAsyncStatus_Success;
+		if (Status != WGPUMapAsyncStatus_Success)
+		{
+			UE_LOG(LogTemp, Warning, TEXT(" buffer_map status=%#.8x"), Status);
+		}
+	};
+
+	wgpuBufferMapAsync(StagingBuffer, WGPUMapMode_Read, 0, Size, ReadMapInfo);
+
+	// --- Poll for map completion ---
+	wgpuDevicePoll(Device, true, nullptr);
+
+	if (bMapped)
+	{
+		const void* Mapped = wgpuBufferGetConstMappedRange(StagingBuffer, 0, Size);
+		FMemory::Memcpy(OutData, Mapped, Size);
+		wgpuBufferUnmap(StagingBuffer);
+	}
+
+	wgpuCommandBufferRelease(CommandBuffer);
+	wgpuCommandEncoderRelease(CommandEncoder);
+	wgpuBufferRelease(StagingBuffer);
+
+	return bMapped;
+}
+
+bool FWebGPUContext::HasFeature(WGPUFeatureName Feature) const
+{
+	return Device && wgpuDeviceHasFeature(Device, Feature);
+}
+
+void FWebGPUContext::Submit(WGPUCommandEncoder CommandEncoder)
+{
+	UniformRing.Flush();
+
+	WGPUCommandBuffer CommandBuffer = wgpuCommandEncoderFinish(CommandEncoder, nullptr);
+	assert(CommandBuffer);
+
+	wgpuQueueSubmit(Queue, 1, &CommandBuffer);
+	UniformRing.MarkSubmitted();
+
+	wgpuCommandBufferRelease(CommandBuffer);
+	wgpuCommandEncoderRelease(CommandEncoder);
+}
+
+FWebGPUUniformRing& FWebGPUContext::GetUniformRing()
+{
+	if (!UniformRing.IsInitialized())
+	{
+		UniformRing.Initialize(*this);
+	}
+	return UniformRing;
+}
+
+const WGPULimits& FWebGPUContext::GetLimits() const
+{
+	if (CachedLimitsDevice != Device || !Device)
+	{
+		CachedLimits = {};
+		if (Device && wgpuDeviceGetLimits(Device, &CachedLimits) == WGPUStatus_Success)
+		{
+			CachedLimitsDevice = Device;
+		}
+		else
+		{
+			//Spec defaults, every adapter supports at least these
+			CachedLimits = {};
+			CachedLimits.maxUniformBufferBindingSize = 64 * 1024;
+			CachedLimits.maxStorageBufferBindingSize = 128ull * 1024 * 1024;
+			CachedLimits.minUniformBufferOffsetAlignment = 256;
+			CachedLimits.minStorageBufferOffsetAlignment = 256;
+			CachedLimits.maxBufferSize = 256ull * 1024 * 1024;
+			CachedLimits.maxComputeWorkgroupStorageSize = 16384;
+			CachedLimits.maxComputeInvocationsPerWorkgroup = 256;
+			CachedLimits.maxComputeWorkgroupSizeX = 256;
+			CachedLimits.maxComputeWorkgroupSizeY = 256;
+			CachedLimits.maxComputeWorkgroupSizeZ = 64;
+			CachedLimits.maxComputeWorkgroupsPerDimension = 65535;
+		}
+	}
+	return CachedLimits;
+}
+
+void FWebGPUContext::GetGroupCounts(uint64 NumGroups, uint32& OutX, uint32& OutY) const
+{
+	OutX = (uint32)FMath::Min<uint64>(NumGroups, GetMaxWorkgroupsPerDimension());
+	OutY = OutX > 0 ? (uint32)((NumGroups + OutX - 1) / OutX) : 0;
+}
+
+WGPUBuffer FWebGPUContext::EnsureScratchBuffer(WGPUBuffer& Buffer, uint64& Capacity, uint64 Size, WGPUBufferUsage Usage, const char* Label)
+{
+	if (Capacity < Size || !Buffer)
+	{
+		if (Buffer)
+		{
+			wgpuBufferRelease(Buffer);
+		}
+		Buffer = CreateBuffer(Size, Usage, Label);
+		Capacity = Buffer ? Size : 0;
+	}
+	return Buffer;
+}
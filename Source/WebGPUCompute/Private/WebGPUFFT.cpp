@@ -0,0 +1,601 @@
+#include "WebGPUFFT.h"
+#include "WebGPUContext.h"
+
+namespace
+{
+	const char* FFTCommonSource = (R"(
+const WG: u32 = 64u;
+
+fn cmul(a: vec2<f32>, b: vec2<f32>) -> vec2<f32> {
+	return vec2<f32>(a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x);
+}
+
+fn thread_index(wid: vec3<u32>, nwg: vec3<u32>, lid: u32) -> u32 {
+	return (wid.y * nwg.x + wid.x) * WG + lid;
+}
+		)");
+
+	//RADIX is substituted with 2u, 4u or 8u, the unused butterflies fold away
+	const char* StockhamSource = (R"(
+struct Params {
+	n: u32,
+	ns: u32,
+	batch: u32,
+	inverse: u32,
+	scale: f32,
+	pad0: u32,
+	pad1: u32,
+	pad2: u32,
+}
+
+const R: u32 = RADIX;
+const H: f32 = 0.70710678118654752;
+
+@group(0) @binding(0) var<storage, read> src: array<vec2<f32>>;
+@group(0) @binding(1) var<storage, read_write> dst: array<vec2<f32>>;
+@group(0) @binding(2) var<storage, read> twiddles: array<vec2<f32>>;
+@group(1) @binding(0) var<uniform> params: Params;
+
+// v * (i * dir), a quarter turn in the transform direction
+fn rot(v: vec2<f32>, dir: f32) -> vec2<f32> {
+	return vec2<f32>(-v.y * dir, v.x * dir);
+}
+
+fn dft4(a: vec2<f32>, b: vec2<f32>, c: vec2<f32>, d: vec2<f32>, dir: f32) -> array<vec2<f32>, 4> {
+	let s0 = a + c;
+	let s1 = a - c;
+	let s2 = b + d;
+	let t = rot(b - d, dir);
+	return array<vec2<f32>, 4>(s0 + s2, s1 + t, s0 - s2, s1 - t);
+}
+
+@compute
+@workgroup_size(64)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let per_signal = params.n / R;
+	let t = thread_index(wid, nwg, lid);
+	if (t >= per_signal * params.batch) {
+		return;
+	}
+
+	let base = (t / per_signal) * params.n;
+	let j = t % per_signal;
+	let k = j % params.ns;
+	let tw_step = params.n / (params.ns * R);
+	let dir = select(-1.0, 1.0, params.inverse != 0u);
+
+	// strided load, twiddled by w_(ns*R)^(k*r) from the length-n table
+	var v: array<vec2<f32>, 8>;
+	for (var r = 0u; r < R; r++) {
+		var w = twiddles[k * r * tw_step];
+		w.y *= -dir;
+		v[r] = cmul(src[base + j + r * per_signal], w);
+	}
+
+	if (R == 2u) {
+		let a = v[0];
+		v[0] = a + v[1];
+		v[1] = a - v[1];
+	} else if (R == 4u) {
+		let x = dft4(v[0], v[1], v[2], v[3], dir);
+		for (var r = 0u; r < 4u; r++) {
+			v[r] = x[r];
+		}
+	} else {
+		// radix 8 as two radix 4 halves and a final radix 2 with w8 twiddles
+		let e = dft4(v[0], v[2], v[4], v[6], dir);
+		var o = dft4(v[1], v[3], v[5], v[7], dir);
+		o[1] = cmul(o[1], vec2<f32>(H, dir * H));
+		o[2] = rot(o[2], dir);
+		o[3] = cmul(o[3], vec2<f32>(-H, dir * H));
+		for (var r = 0u; r < 4u; r++) {
+			v[r] = e[r] + o[r];
+			v[r + 4u] = e[r] - o[r];
+		}
+	}
+
+	// autosort: outputs of this butterfly land ns apart
+	let out = (j / params.ns) * params.ns * R + k;
+	for (var r = 0u; r < R; r++) {
+		dst[base + out + r * params.ns] = v[r] * params.scale;
+	}
+}
+		)");
+
+	//Chirp-z stages around the padded power of two convolution
+	const char* BluesteinSource = (R"(
+struct Params {
+	n: u32,
+	m: u32,
+	batch: u32,
+	inverse: u32,
+	scale: f32,
+	pad0: u32,
+	pad1: u32,
+	pad2: u32,
+}
+
+@group(0) @binding(0) var<storage, read> src: array<vec2<f32>>;
+@group(0) @binding(1) var<storage, read_write> dst: array<vec2<f32>>;
+@group(0) @binding(2) var<storage, read> table: array<vec2<f32>>;
+@group(1) @binding(0) var<uniform> params: Params;
+
+// forward chirp e^(-pi i k^2 / n), conjugated for the inverse
+fn chirp(k: u32) -> vec2<f32> {
+	let c = table[k];
+	return select(c, vec2<f32>(c.x, -c.y), params.inverse != 0u);
+}
+
+// x_k * chirp_k, zero padded from n to m
+@compute
+@workgroup_size(64)
+fn premul(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let t = thread_index(wid, nwg, lid);
+	if (t >= params.m * params.batch) {
+		return;
+	}
+	let k = t % params.m;
+	var v = vec2<f32>(0.0, 0.0);
+	if (k < params.n) {
+		v = cmul(src[(t / params.m) * params.n + k], chirp(k));
+	}
+	dst[t] = v;
+}
+
+// spectrum product with the precomputed chirp spectrum of this direction
+@compute
+@workgroup_size(64)
+fn pointwise(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let t = thread_index(wid, nwg, lid);
+	if (t >= params.m * params.batch) {
+		return;
+	}
+	let offset = select(0u, params.m, params.inverse != 0u);
+	dst[t] = cmul(src[t], table[offset + t % params.m]);
+}
+
+// first n of the convolution times chirp_k
+@compute
+@workgroup_size(64)
+fn postmul(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let t = thread_index(wid, nwg, lid);
+	if (t >= params.n * params.batch) {
+		return;
+	}
+	let k = t % params.n;
+	dst[t] = cmul(src[(t / params.n) * params.m + k], chirp(k)) * params.scale;
+}
+		)");
+
+	const char* TransposeSource = (R"(
+struct Params {
+	width: u32,
+	height: u32,
+	pad0: u32,
+	pad1: u32,
+}
+
+@group(0) @binding(0) var<storage, read> src: array<vec2<f32>>;
+@group(0) @binding(1) var<storage, read_write> dst: array<vec2<f32>>;
+@group(1) @binding(0) var<uniform> params: Params;
+
+// padded row avoids bank conflicts on the column read
+var<workgroup> tile: array<vec2<f32>, 272>;
+
+@compute
+@workgroup_size(16, 16)
+fn main(@builtin(local_invocation_id) lid: vec3<u32>,
+	@builtin(workgroup_id) wid: vec3<u32>) {
+	let base = wid.z * params.width * params.height;
+	let x = wid.x * 16u + lid.x;
+	let y = wid.y * 16u + lid.y;
+	if (x < params.width && y < params.height) {
+		tile[lid.y * 17u + lid.x] = src[base + y * params.width + x];
+	}
+	workgroupBarrier();
+
+	// output is height wide, rows of the tile become columns
+	let ox = wid.y * 16u + lid.x;
+	let oy = wid.x * 16u + lid.y;
+	if (ox < params.height && oy < params.width) {
+		dst[base + oy * params.height + ox] = tile[lid.x * 17u + lid.y];
+	}
+}
+		)");
+
+	//Plain iterative radix-2 forward DFT in double, only used to build chirp spectra
+	void CPUTransform(TArray<double>& Re, TArray<double>& Im)
+	{
+		const int32 N = Re.Num();
+		for (int32 i = 1, j = 0; i < N; i++)
+		{
+			int32 Bit = N >> 1;
+			for (; j & Bit; Bit >>= 1)
+			{
+				j ^= Bit;
+			}
+			j ^= Bit;
+			if (i < j)
+			{
+				Swap(Re[i], Re[j]);
+				Swap(Im[i], Im[j]);
+			}
+		}
+
+		for (int32 Len = 2; Len <= N; Len <<= 1)
+		{
+			const double Angle = -2.0 * UE_DOUBLE_PI / Len;
+			for (int32 i = 0; i < N; i += Len)
+			{
+				for (int32 k = 0; k < Len / 2; k++)
+				{
+					const double WRe = FMath::Cos(Angle * k);
+					const double WIm = FMath::Sin(Angle * k);
+					const int32 A = i + k;
+					const int32 B = i + k + Len / 2;
+					const double TRe = Re[B] * WRe - Im[B] * WIm;
+					const double TIm = Re[B] * WIm + Im[B] * WRe;
+					Re[B] = Re[A] - TRe;
+					Im[B] = Im[A] - TIm;
+					Re[A] += TRe;
+					Im[A] += TIm;
+				}
+			}
+		}
+	}
+}
+
+FWebGPUFFT::~FWebGPUFFT()
+{
+	Release();
+}
+
+bool FWebGPUFFT::Initialize(FWebGPUContext& InContext)
+{
+	Release();
+
+	Context = &InContext;
+
+	const TCHAR* Radix[3] = { TEXT("2u"), TEXT("4u"), TEXT("8u") };
+	const TArray<WGPUBufferBindingType> Bindings = { WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_Storage, WGPUBufferBindingType_ReadOnlyStorage };
+
+	bool bCreated = true;
+	for (int32 i = 0; i < 3; i++)
+	{
+		FString Source = FString(FFTCommonSource) + FString(StockhamSource);
+		Source.ReplaceInline(TEXT("RADIX"), Radix[i]);
+		bCreated &= StockhamKernels[i].Create(*Context, Source, Bindings, true);
+	}
+
+	const FString BluesteinKernelSource = FString(FFTCommonSource) + FString(BluesteinSource);
+	bCreated &= BluesteinPremul.Create(*Context, BluesteinKernelSource, Bindings, true, "premul");
+	bCreated &= BluesteinPointwise.Create(*Context, BluesteinKernelSource, Bindings, true, "pointwise");
+	bCreated &= BluesteinPostmul.Create(*Context, BluesteinKernelSource, Bindings, true, "postmul");
+	bCreated &= Transpose.Create(*Context, FString(TransposeSource), { WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_Storage }, true);
+
+	if (!bCreated)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FFT kernels failed to compile"));
+		Release();
+		return false;
+	}
+	return true;
+}
+
+void FWebGPUFFT::Release()
+{
+	for (FWebGPUKernel& Kernel : StockhamKernels)
+	{
+		Kernel.Release();
+	}
+	BluesteinPremul.Release();
+	BluesteinPointwise.Release();
+	BluesteinPostmul.Release();
+	Transpose.Release();
+
+	for (auto& Pair : Plans)
+	{
+		ReleasePlan(*Pair.Value);
+	}
+	Plans.Empty();
+
+	for (int32 i = 0; i < 2; i++)
+	{
+		for (WGPUBuffer* Buffer : { &Scratch[i], &Padded[i], &Work2D[i] })
+		{
+			if (*Buffer)
+			{
+				wgpuBufferRelease(*Buffer);
+				*Buffer = nullptr;
+			}
+		}
+		ScratchCapacity[i] = 0;
+		PaddedCapacity[i] = 0;
+		Work2DCapacity[i] = 0;
+	}
+
+	Context = nullptr;
+}
+
+void FWebGPUFFT::ReleasePlan(FFFTPlan& Plan)
+{
+	for (WGPUBuffer* Buffer : { &Plan.Twiddles, &Plan.Chirp, &Plan.ChirpSpectrum })
+	{
+		if (*Buffer)
+		{
+			wgpuBufferRelease(*Buffer);
+			*Buffer = nullptr;
+		}
+	}
+}
+
+FWebGPUFFT::FFFTPlan* FWebGPUFFT::GetPlan(uint32 N)
+{
+	if (TUniquePtr<FFFTPlan>* Existing = Plans.Find(N))
+	{
+		return Existing->Get();
+	}
+
+	TUniquePtr<FFFTPlan> Plan = MakeUnique<FFFTPlan>();
+	Plan->N = N;
+
+	if (FMath::IsPowerOfTwo(N))
+	{
+		//Radix 8 passes first, one radix 4 or 2 pass for the remaining bits
+		uint32 Bits = FMath::FloorLog2(N);
+		while (Bits >= 3)
+		{
+			Plan->Radices.Add(8);
+			Bits -= 3;
+		}
+		if (Bits > 0)
+		{
+			Plan->Radices.Add(1u << Bits);
+		}
+
+		TArray<float> Twiddles;
+		Twiddles.SetNumUninitialized(N * 2);
+		for (uint32 k = 0; k < N; k++)
+		{
+			const double Angle = -2.0 * UE_DOUBLE_PI * k / N;
+			Twiddles[k * 2] = (float)FMath::Cos(Angle);
+			Twiddles[k * 2 + 1] = (float)FMath::Sin(Angle);
+		}
+
+		Plan->Twiddles = Context->CreateBuffer((uint64)N * 8, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "fft_twiddles_buffer");
+		wgpuQueueWriteBuffer(Context->Queue, Plan->Twiddles, 0, Twiddles.GetData(), (uint64)N * 8);
+	}
+	else
+	{
+		//Linear convolution of n samples with a 2n-1 chirp needs m >= 2n - 1
+		Plan->M = FMath::RoundUpToPowerOfTwo(2 * N - 1);
+		const uint32 M = Plan->M;
+
+		//n^2 mod 2n keeps the angle exact for large k
+		TArray<double> ChirpRe, ChirpIm;
+		ChirpRe.SetNumUninitialized(N);
+		ChirpIm.SetNumUninitialized(N);
+		for (uint32 k = 0; k < N; k++)
+		{
+			const uint64 K2 = ((uint64)k * k) % (2ull * N);
+			const double Angle = -UE_DOUBLE_PI * (double)K2 / N;
+			ChirpRe[k] = FMath::Cos(Angle);
+			ChirpIm[k] = FMath::Sin(Angle);
+		}
+
+		//Circular convolution kernel b_m = conj(chirp_|m|), the inverse transform uses conj(conj(chirp))
+		TArray<float> Spectrum;
+		Spectrum.SetNumUninitialized(M * 4);
+		for (int32 Direction = 0; Direction < 2; Direction++)
+		{
+			const double Sign = Direction == 0 ? -1.0 : 1.0;
+			TArray<double> Re, Im;
+			Re.SetNumZeroed(M);
+			Im.SetNumZeroed(M);
+			for (uint32 k = 0; k < N; k++)
+			{
+				Re[k] = ChirpRe[k];
+				Im[k] = Sign * ChirpIm[k];
+				if (k > 0)
+				{
+					Re[M - k] = Re[k];
+					Im[M - k] = Im[k];
+				}
+			}
+			CPUTransform(Re, Im);
+			for (uint32 k = 0; k < M; k++)
+			{
+				Spectrum[(Direction * M + k) * 2] = (float)Re[k];
+				Spectrum[(Direction * M + k) * 2 + 1] = (float)Im[k];
+			}
+		}
+
+		TArray<float> Chirp;
+		Chirp.SetNumUninitialized(N * 2);
+		for (uint32 k = 0; k < N; k++)
+		{
+			Chirp[k * 2] = (float)ChirpRe[k];
+			Chirp[k * 2 + 1] = (float)ChirpIm[k];
+		}
+
+		Plan->Chirp = Context->CreateBuffer((uint64)N * 8, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "fft_chirp_buffer");
+		Plan->ChirpSpectrum = Context->CreateBuffer((uint64)M * 16, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "fft_chirp_spectrum_buffer");
+		wgpuQueueWriteBuffer(Context->Queue, Plan->Chirp, 0, Chirp.GetData(), (uint64)N * 8);
+		wgpuQueueWriteBuffer(Context->Queue, Plan->ChirpSpectrum, 0, Spectrum.GetData(), (uint64)M * 16);
+	}
+
+	FFFTPlan* Result = Plan.Get();
+	Plans.Add(N, MoveTemp(Plan));
+	return Result;
+}
+
+bool FWebGPUFFT::EncodePow2(WGPUComputePassEncoder Pass, const FFFTPlan& Plan, WGPUBuffer Input, WGPUBuffer Output, uint32 Batch, bool bInverse, float Scale)
+{
+	const uint64 NumElements = (uint64)Plan.N * Batch;
+	const int32 NumPasses = Plan.Radices.Num();
+
+	FStockhamParams Params = {};
+	Params.N = Plan.N;
+	Params.Ns = 1;
+	Params.Batch = Batch;
+	Params.Inverse = bInverse ? 1 : 0;
+
+	WGPUBuffer Source = Input;
+	for (int32 i = 0; i < NumPasses; i++)
+	{
+		const bool bLast = i == NumPasses - 1;
+		const uint32 Radix = Plan.Radices[i];
+		WGPUBuffer Target = bLast ? Output : Context->EnsureScratchBuffer(Scratch[i & 1], ScratchCapacity[i & 1], NumElements * 8, WGPUBufferUsage_Storage, "fft_scratch_buffer");
+
+		Params.Scale = bLast ? Scale : 1.0f;
+
+		const FWebGPUKernel& Kernel = StockhamKernels[Radix == 2 ? 0 : Radix == 4 ? 1 : 2];
+		uint32 GroupsX, GroupsY;
+		Context->GetGroupCounts(FMath::DivideAndRoundUp<uint64>(NumElements / Radix, WorkgroupSize), GroupsX, GroupsY);
+
+		WGPUBindGroup BindGroup = Kernel.CreateBindGroup({ Source, Target, Plan.Twiddles });
+		const bool bDispatched = Kernel.Dispatch(Pass, BindGroup, Params, GroupsX, GroupsY);
+		wgpuBindGroupRelease(BindGroup);
+		if (!bDispatched)
+		{
+			return false;
+		}
+
+		Params.Ns *= Radix;
+		Source = Target;
+	}
+	return true;
+}
+
+bool FWebGPUFFT::EncodeBluestein(WGPUComputePassEncoder Pass, const FFFTPlan& Plan, WGPUBuffer Input, WGPUBuffer Output, uint32 Batch, bool bInverse)
+{
+	const FFFTPlan* Inner = GetPlan(Plan.M);
+	const uint64 NumPadded = (uint64)Plan.M * Batch;
+	WGPUBuffer A = Context->EnsureScratchBuffer(Padded[0], PaddedCapacity[0], NumPadded * 8, WGPUBufferUsage_Storage, "fft_padded_buffer");
+	WGPUBuffer B = Context->EnsureScratchBuffer(Padded[1], PaddedCapacity[1], NumPadded * 8, WGPUBufferUsage_Storage, "fft_padded_buffer");
+
+	FBluesteinParams Params = {};
+	Params.N = Plan.N;
+	Params.M = Plan.M;
+	Params.Batch = Batch;
+	Params.Inverse = bInverse ? 1 : 0;
+	Params.Scale = bInverse ? 1.0f / Plan.N : 1.0f;
+
+	uint32 GroupsX, GroupsY;
+	Context->GetGroupCounts(FMath::DivideAndRoundUp<uint64>(NumPadded, WorkgroupSize), GroupsX, GroupsY);
+
+	WGPUBindGroup BindGroup = BluesteinPremul.CreateBindGroup({ Input, A, Plan.Chirp });
+	bool bDispatched = BluesteinPremul.Dispatch(Pass, BindGroup, Params, GroupsX, GroupsY);
+	wgpuBindGroupRelease(BindGroup);
+	if (!bDispatched || !EncodePow2(Pass, *Inner, A, B, Batch, false, 1.0f))
+	{
+		return false;
+	}
+
+	BindGroup = BluesteinPointwise.CreateBindGroup({ B, A, Plan.ChirpSpectrum });
+	bDispatched = BluesteinPointwise.Dispatch(Pass, BindGroup, Params, GroupsX, GroupsY);
+	wgpuBindGroupRelease(BindGroup);
+	if (!bDispatched || !EncodePow2(Pass, *Inner, A, B, Batch, true, 1.0f / Plan.M))
+	{
+		return false;
+	}
+
+	Context->GetGroupCounts(FMath::DivideAndRoundUp<uint64>((uint64)Plan.N * Batch, WorkgroupSize), GroupsX, GroupsY);
+	BindGroup = BluesteinPostmul.CreateBindGroup({ B, Output, Plan.Chirp });
+	bDispatched = BluesteinPostmul.Dispatch(Pass, BindGroup, Params, GroupsX, GroupsY);
+	wgpuBindGroupRelease(BindGroup);
+	return bDispatched;
+}
+
+bool FWebGPUFFT::EncodeTranspose(WGPUComputePassEncoder Pass, WGPUBuffer Input, WGPUBuffer Output, uint32 Width, uint32 Height, uint32 Batch)
+{
+	FTransposeParams Params = {};
+	Params.Width = Width;
+	Params.Height = Height;
+
+	WGPUBindGroup BindGroup = Transpose.CreateBindGroup({ Input, Output });
+	const bool bDispatched = Transpose.Dispatch(Pass, BindGroup, Params, FMath::DivideAndRoundUp(Width, TransposeTile), FMath::DivideAndRoundUp(Height, TransposeTile), Batch);
+	wgpuBindGroupRelease(BindGroup);
+	return bDispatched;
+}
+
+bool FWebGPUFFT::EncodeFFT1D(WGPUComputePassEncoder Pass, WGPUBuffer Input, WGPUBuffer Output, uint32 N, uint32 Batch, bool bInverse)
+{
+	if (!IsInitialized() || N < 2 || Batch == 0 || Input == Output)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Invalid FFT setup: length %u, batch %u"), N, Batch);
+		return false;
+	}
+
+	const FFFTPlan* Plan = GetPlan(N);
+	if (Plan->M > 0)
+	{
+		return EncodeBluestein(Pass, *Plan, Input, Output, Batch, bInverse);
+	}
+	return EncodePow2(Pass, *Plan, Input, Output, Batch, bInverse, bInverse ? 1.0f / N : 1.0f);
+}
+
+bool FWebGPUFFT::EncodeFFT2D(WGPUComputePassEncoder Pass, WGPUBuffer Input, WGPUBuffer Output, uint32 Width, uint32 Height, uint32 Batch, bool bInverse)
+{
+	if (!IsInitialized() || Width < 2 || Height < 2 || Batch == 0 || Batch > Context->GetMaxWorkgroupsPerDimension() || Input == Output)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Invalid 2D FFT setup: %ux%u, batch %u"), Width, Height, Batch);
+		return false;
+	}
+
+	const uint64 NumElements = (uint64)Width * Height * Batch;
+	WGPUBuffer A = Context->EnsureScratchBuffer(Work2D[0], Work2DCapacity[0], NumElements * 8, WGPUBufferUsage_Storage, "fft_2d_buffer");
+	WGPUBuffer B = Context->EnsureScratchBuffer(Work2D[1], Work2DCapacity[1], NumElements * 8, WGPUBufferUsage_Storage, "fft_2d_buffer");
+
+	//Columns become contiguous rows after the transpose
+	return EncodeFFT1D(Pass, Input, A, Width, Height * Batch, bInverse) &&
+		EncodeTranspose(Pass, A, B, Width, Height, Batch) &&
+		EncodeFFT1D(Pass, B, A, Height, Width * Batch, bInverse) &&
+		EncodeTranspose(Pass, A, Output, Height, Width, Batch);
+}
+
+bool FWebGPUFFT::FFT1D(WGPUBuffer Input, WGPUBuffer Output, uint32 N, uint32 Batch, bool bInverse)
+{
+	if (!IsInitialized())
+	{
+		return false;
+	}
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+	const bool bEncoded = EncodeFFT1D(ComputePassEncoder, Input, Output, N, Batch, bInverse);
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	Context->Submit(CommandEncoder);
+	return bEncoded;
+}
+
+bool FWebGPUFFT::FFT2D(WGPUBuffer Input, WGPUBuffer Output, uint32 Width, uint32 Height, uint32 Batch, bool bInverse)
+{
+	if (!IsInitialized())
+	{
+		return false;
+	}
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+	const bool bEncoded = EncodeFFT2D(ComputePassEncoder, Input, Output, Width, Height, Batch, bInverse);
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	Context->Submit(CommandEncoder);
+	return bEncoded;
+}
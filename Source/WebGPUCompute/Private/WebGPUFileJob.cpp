@@ -0,0 +1,78 @@
+#include "WebGPUFileJob.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+
+bool FWebGPUFileJob::Initialize(FWebGPUContext& InContext, const FString& Source, uint32 WorkgroupSize, uint64 MaxChunkBytes)
+{
+	return Executor.Initialize(InContext, Source, WorkgroupSize, MaxChunkBytes);
+}
+
+void FWebGPUFileJob::Release()
+{
+	Executor.Release();
+}
+
+bool FWebGPUFileJob::Run(const FString& InputPath, const FString& OutputPath, uint32 ElementSize)
+{
+	if (!Executor.IsInitialized())
+	{
+		return false;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	TUniquePtr<IMappedFileHandle> InputHandle(PlatformFile.OpenMapped(*InputPath));
+	if (!InputHandle)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not memory map compute input %s"), *InputPath);
+		return false;
+	}
+
+	TUniquePtr<IFileHandle> OutputHandle(PlatformFile.OpenWrite(*OutputPath));
+	if (!OutputHandle)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not open compute output %s"), *OutputPath);
+		return false;
+	}
+
+	const uint64 TotalBytes = InputHandle->GetFileSize();
+	bool bIOFailed = false;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	const bool bSuccess = Executor.Run(TotalBytes, ElementSize,
+		[&InputHandle, &bIOFailed](uint64 Offset, void* Dst, uint64 Size)
+		{
+			//Only this chunk's window is mapped, the OS pages it in and drops it again after the copy
+			TUniquePtr<IMappedFileRegion> Region(InputHandle->MapRegion(Offset, Size));
+			if (Region && Region->GetMappedPtr())
+			{
+				FMemory::Memcpy(Dst, Region->GetMappedPtr(), Size);
+			}
+			else
+			{
+				bIOFailed = true;
+				FMemory::Memzero(Dst, Size);
+			}
+		},
+		[&OutputHandle, &bIOFailed](uint64 Offset, const void* Src, uint64 Size)
+		{
+			//Runs while the next chunk is still computing, so the write overlaps gpu work
+			if (!OutputHandle->Seek(Offset) || !OutputHandle->Write(static_cast<const uint8*>(Src), Size))
+			{
+				bIOFailed = true;
+			}
+		});
+
+	OutputHandle->Flush();
+
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+	if (!bSuccess || bIOFailed)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Compute file job %s -> %s failed"), *InputPath, *OutputPath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Compute file job processed %llu bytes in %.3fs (%.2f GB/s)"), TotalBytes, Seconds, Seconds > 0.0 ? (TotalBytes / Seconds) / 1e9 : 0.0);
+	return true;
+}
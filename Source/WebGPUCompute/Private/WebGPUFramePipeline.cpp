@@ -0,0 +1,216 @@
+#include "WebGPUFramePipeline.h"
+#include "WebGPUContext.h"
+
+FWebGPUFramePipeline::~FWebGPUFramePipeline()
+{
+	Release();
+}
+
+bool FWebGPUFramePipeline::Initialize(FWebGPUContext& InContext, const FString& Source, int32 InFramesInFlight)
+{
+	Release();
+
+	Context = &InContext;
+
+	if (!Kernel.Create(*Context, Source, { WGPUBufferBindingType_Storage }, false))
+	{
+		return false;
+	}
+
+	//2 is the minimum that still overlaps, past 3 only adds latency
+	Slots.SetNum(FMath::Clamp(InFramesInFlight, 2, 3));
+	for (FFrameSlot& Slot : Slots)
+	{
+		Slot.Owner = this;
+	}
+
+	NextFrameIndex = 0;
+	LatestResult.Reset();
+	LatestFrameIndex = INDEX_NONE;
+	bHasNewResult = false;
+	return true;
+}
+
+void FWebGPUFramePipeline::Release()
+{
+	if (Context && Context->Device)
+	{
+		//Let outstanding map callbacks land before their slots go away
+		for (FFrameSlot& Slot : Slots)
+		{
+			if (Slot.State == ESlotState::InFlight)
+			{
+				wgpuDevicePoll(Context->Device, true, nullptr);
+				break;
+			}
+		}
+	}
+
+	for (FFrameSlot& Slot : Slots)
+	{
+		ReleaseSlot(Slot);
+	}
+	Slots.Empty();
+	Kernel.Release();
+	Context = nullptr;
+}
+
+void FWebGPUFramePipeline::ReleaseSlot(FFrameSlot& Slot)
+{
+	if (Slot.BindGroup)
+	{
+		wgpuBindGroupRelease(Slot.BindGroup);
+		Slot.BindGroup = nullptr;
+	}
+	if (Slot.StagingBuffer)
+	{
+		wgpuBufferRelease(Slot.StagingBuffer);
+		Slot.StagingBuffer = nullptr;
+	}
+	if (Slot.StorageBuffer)
+	{
+		wgpuBufferRelease(Slot.StorageBuffer);
+		Slot.StorageBuffer = nullptr;
+	}
+	Slot.Capacity = 0;
+}
+
+bool FWebGPUFramePipeline::EnsureSlotCapacity(FFrameSlot& Slot, uint64 Size)
+{
+	if (Slot.Capacity >= Size && Slot.StorageBuffer)
+	{
+		return true;
+	}
+
+	ReleaseSlot(Slot);
+
+	Slot.StorageBuffer = Context->CreateBuffer(Size, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "pipelined_storage_buffer");
+	Slot.StagingBuffer = Context->CreateBuffer(Size, WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst, "pipelined_staging_buffer");
+	Slot.BindGroup = Kernel.CreateBindGroup({ Slot.StorageBuffer });
+	Slot.Capacity = Size;
+
+	return Slot.BindGroup != nullptr;
+}
+
+bool FWebGPUFramePipeline::Submit(const TArray<int32>& InData)
+{
+	if (!IsInitialized() || InData.Num() == 0)
+	{
+		return false;
+	}
+
+	const int64 FrameIndex = NextFrameIndex;
+	FFrameSlot& Slot = Slots[FrameIndex % Slots.Num()];
+
+	if (Slot.State == ESlotState::InFlight)
+	{
+		//Gpu is more than FramesInFlight behind, wait for just that submission
+		UE_LOG(LogTemp, Verbose, TEXT("Pipelined frame %lld waiting on frame %lld"), FrameIndex, Slot.FrameIndex);
+		wgpuDevicePoll(Context->Device, true, &Slot.SubmissionIndex);
+		if (Slot.State == ESlotState::InFlight)
+		{
+			return false;
+		}
+	}
+
+	const uint64 Size = InData.Num() * sizeof(int32);
+	if (!EnsureSlotCapacity(Slot, Size))
+	{
+		return false;
+	}
+
+	wgpuQueueWriteBuffer(Context->Queue, Slot.StorageBuffer, 0, InData.GetData(), Size);
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+	Kernel.Dispatch(ComputePassEncoder, Slot.BindGroup, nullptr, 0, InData.Num());
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	wgpuCommandEncoderCopyBufferToBuffer(CommandEncoder, Slot.StorageBuffer, 0, Slot.StagingBuffer, 0, Size);
+
+	Context->GetUniformRing().Flush();
+
+	WGPUCommandBuffer CommandBuffer = wgpuCommandEncoderFinish(CommandEncoder, nullptr);
+	Slot.SubmissionIndex = wgpuQueueSubmitForIndex(Context->Queue, 1, &CommandBuffer);
+	Context->GetUniformRing().MarkSubmitted();
+	wgpuCommandBufferRelease(CommandBuffer);
+	wgpuCommandEncoderRelease(CommandEncoder);
+
+	Slot.Size = Size;
+	Slot.FrameIndex = FrameIndex;
+	Slot.State = ESlotState::InFlight;
+
+	//Resolves once the copy above has executed, picked up by a later Tick()
+	WGPUBufferMapCallbackInfo ReadMapInfo = {};
+	ReadMapInfo.mode = WGPUCallbackMode_AllowProcessEvents;
+	ReadMapInfo.userdata1 = &Slot;
+	ReadMapInfo.callback = [](WGPUMapAsyncStatus Status, WGPUStringView Message, void* UserData1, void* UserData2)
+	{
+		FFrameSlot& MappedSlot = *reinterpret_cast<FFrameSlot*>(UserData1);
+		MappedSlot.Owner->OnSlotMapped(MappedSlot, Status == WGPUMapAsyncStatus_Success);
+	};
+
+	wgpuBufferMapAsync(Slot.StagingBuffer, WGPUMapMode_Read, 0, Size, ReadMapInfo);
+
+	NextFrameIndex++;
+	return true;
+}
+
+void FWebGPUFramePipeline::OnSlotMapped(FFrameSlot& Slot, bool bSuccess)
+{
+	if (bSuccess)
+	{
+		//Slots can complete out of order relative to our bookkeeping, never go backwards
+		if (Slot.FrameIndex > LatestFrameIndex)
+		{
+			const int32 NumElements = Slot.Size / sizeof(int32);
+			const void* Mapped = wgpuBufferGetConstMappedRange(Slot.StagingBuffer, 0, Slot.Size);
+
+			LatestResult.SetNumUninitialized(NumElements);
+			FMemory::Memcpy(LatestResult.GetData(), Mapped, Slot.Size);
+			LatestFrameIndex = Slot.FrameIndex;
+			bHasNewResult = true;
+		}
+		wgpuBufferUnmap(Slot.StagingBuffer);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Pipelined frame %lld failed to map"), Slot.FrameIndex);
+	}
+
+	Slot.State = ESlotState::Idle;
+}
+
+void FWebGPUFramePipeline::Tick()
+{
+	if (IsInitialized())
+	{
+		wgpuDevicePoll(Context->Device, false, nullptr);
+	}
+}
+
+bool FWebGPUFramePipeline::GetLatestResult(TArray<int32>& OutData, int64& OutFrameIndex) const
+{
+	if (LatestFrameIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutData = LatestResult;
+	OutFrameIndex = LatestFrameIndex;
+	return true;
+}
+
+bool FWebGPUFramePipeline::ConsumeNewResult(TArray<int32>& OutData, int64& OutFrameIndex)
+{
+	if (!bHasNewResult)
+	{
+		return false;
+	}
+
+	bHasNewResult = false;
+	return GetLatestResult(OutData, OutFrameIndex);
+}
@@ -0,0 +1,213 @@
+#include "WebGPUGemm.h"
+#include "WebGPUContext.h"
+
+namespace
+{
+	//ELEM_T is f32 or f16, ENABLE_F16 the matching enable directive
+	const char* GemmSourceTemplate = (R"(
+ENABLE_F16
+
+override TILE_M: u32 = 64u;
+override TILE_N: u32 = 64u;
+override TILE_K: u32 = 16u;
+override TRANS_A: bool = false;
+override TRANS_B: bool = false;
+
+const TM: u32 = 4u;
+const TN: u32 = 4u;
+const MAX_TILE: u32 = 2048u;
+
+struct Params {
+	m: u32,
+	n: u32,
+	k: u32,
+	pad: u32,
+}
+
+@group(0) @binding(0) var<storage, read> a: array<ELEM_T>;
+@group(0) @binding(1) var<storage, read> b: array<ELEM_T>;
+@group(0) @binding(2) var<storage, read_write> c: array<ELEM_T>;
+@group(1) @binding(0) var<uniform> params: Params;
+
+// k-major so each invocation's TM rows / TN columns are contiguous
+var<workgroup> a_tile: array<f32, MAX_TILE>;
+var<workgroup> b_tile: array<f32, MAX_TILE>;
+
+// logical A is m x k, logical B is k x n, out of range reads pad with zero
+fn load_a(row: u32, col: u32) -> f32 {
+	if (row >= params.m || col >= params.k) {
+		return 0.0;
+	}
+	if (TRANS_A) {
+		return f32(a[col * params.m + row]);
+	}
+	return f32(a[row * params.k + col]);
+}
+
+fn load_b(row: u32, col: u32) -> f32 {
+	if (row >= params.k || col >= params.n) {
+		return 0.0;
+	}
+	if (TRANS_B) {
+		return f32(b[col * params.k + row]);
+	}
+	return f32(b[row * params.n + col]);
+}
+
+@compute
+@workgroup_size(TILE_N / TN, TILE_M / TM)
+fn main(@builtin(local_invocation_id) lid: vec3<u32>,
+	@builtin(local_invocation_index) lindex: u32,
+	@builtin(workgroup_id) wid: vec3<u32>) {
+	let threads = (TILE_M / TM) * (TILE_N / TN);
+	let row0 = wid.y * TILE_M;
+	let col0 = wid.x * TILE_N;
+
+	var acc: array<f32, 16>;
+	var a_reg: array<f32, 4>;
+	var b_reg: array<f32, 4>;
+
+	for (var k0 = 0u; k0 < params.k; k0 += TILE_K) {
+		// walk the tile in memory order of the stored matrix so global reads coalesce
+		for (var i = lindex; i < TILE_M * TILE_K; i += threads) {
+			var r = i / TILE_K;
+			var kk = i % TILE_K;
+			if (TRANS_A) {
+				r = i % TILE_M;
+				kk = i / TILE_M;
+			}
+			a_tile[kk * TILE_M + r] = load_a(row0 + r, k0 + kk);
+		}
+		for (var i = lindex; i < TILE_K * TILE_N; i += threads) {
+			var kk = i / TILE_N;
+			var cc = i % TILE_N;
+			if (TRANS_B) {
+				kk = i % TILE_K;
+				cc = i / TILE_K;
+			}
+			b_tile[kk * TILE_N + cc] = load_b(k0 + kk, col0 + cc);
+		}
+		workgroupBarrier();
+
+		for (var kk = 0u; kk < TILE_K; kk++) {
+			for (var i = 0u; i < TM; i++) {
+				a_reg[i] = a_tile[kk * TILE_M + lid.y * TM + i];
+			}
+			for (var j = 0u; j < TN; j++) {
+				b_reg[j] = b_tile[kk * TILE_N + lid.x * TN + j];
+			}
+			for (var i = 0u; i < TM; i++) {
+				for (var j = 0u; j < TN; j++) {
+					acc[i * TN + j] = fma(a_reg[i], b_reg[j], acc[i * TN + j]);
+				}
+			}
+		}
+		workgroupBarrier();
+	}
+
+	for (var i = 0u; i < TM; i++) {
+		let row = row0 + lid.y * TM + i;
+		for (var j = 0u; j < TN; j++) {
+			let col = col0 + lid.x * TN + j;
+			if (row < params.m && col < params.n) {
+				c[row * params.n + col] = ELEM_T(acc[i * TN + j]);
+			}
+		}
+	}
+}
+		)");
+}
+
+FWebGPUGemm::~FWebGPUGemm()
+{
+	Release();
+}
+
+bool FWebGPUGemm::Initialize(FWebGPUContext& InContext, const FWebGPUGemmConfig& InConfig)
+{
+	Release();
+
+	Context = &InContext;
+	Config = InConfig;
+
+	const WGPULimits& Limits = Context->GetLimits();
+
+	const uint32 Invocations = (Config.TileM / ThreadTile) * (Config.TileN / ThreadTile);
+	const bool bValidTiles = Config.TileM % ThreadTile == 0 && Config.TileN % ThreadTile == 0 && Config.TileK > 0 &&
+		Invocations > 0 && Invocations <= FMath::Max(Limits.maxComputeInvocationsPerWorkgroup, 1u) &&
+		Config.TileM * Config.TileK <= MaxTileElements && Config.TileK * Config.TileN <= MaxTileElements;
+
+	if (!bValidTiles)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Invalid GEMM tile config %ux%ux%u"), Config.TileM, Config.TileN, Config.TileK);
+		return false;
+	}
+
+	if (Config.bFloat16 && !Context->HasFeature(WGPUFeatureName_ShaderF16))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GEMM f16 storage requested but the device has no ShaderF16"));
+		return false;
+	}
+
+	FString Source(GemmSourceTemplate);
+	Source.ReplaceInline(TEXT("ENABLE_F16"), Config.bFloat16 ? TEXT("enable f16;") : TEXT(""));
+	Source.ReplaceInline(TEXT("ELEM_T"), Config.bFloat16 ? TEXT("f16") : TEXT("f32"));
+
+	auto MakeConstant = [](const char* Key, double Value)
+	{
+		WGPUConstantEntry Entry = {};
+		Entry.key = { Key, WGPU_STRLEN };
+		Entry.value = Value;
+		return Entry;
+	};
+
+	const TArray<WGPUConstantEntry> Constants = {
+		MakeConstant("TILE_M", Config.TileM),
+		MakeConstant("TILE_N", Config.TileN),
+		MakeConstant("TILE_K", Config.TileK),
+		MakeConstant("TRANS_A", Config.bTransposeA ? 1.0 : 0.0),
+		MakeConstant("TRANS_B", Config.bTransposeB ? 1.0 : 0.0),
+	};
+
+	return Kernel.Create(*Context, Source,
+		{ WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_Storage }, true, "main", Constants);
+}
+
+void FWebGPUGemm::Release()
+{
+	Kernel.Release();
+	Context = nullptr;
+}
+
+bool FWebGPUGemm::EncodeMultiply(WGPUComputePassEncoder Pass, WGPUBuffer A, WGPUBuffer B, WGPUBuffer C, uint32 M, uint32 N, uint32 K) const
+{
+	FGemmParams Params;
+	Params.M = M;
+	Params.N = N;
+	Params.K = K;
+	Params.Pad = 0;
+
+	WGPUBindGroup BindGroup = Kernel.CreateBindGroup({ A, B, C });
+	const bool bDispatched = Kernel.Dispatch(Pass, BindGroup, Params, FMath::DivideAndRoundUp(N, Config.TileN), FMath::DivideAndRoundUp(M, Config.TileM));
+	wgpuBindGroupRelease(BindGroup);
+	return bDispatched;
+}
+
+bool FWebGPUGemm::Multiply(WGPUBuffer A, WGPUBuffer B, WGPUBuffer C, uint32 M, uint32 N, uint32 K) const
+{
+	if (!IsInitialized() || M == 0 || N == 0)
+	{
+		return false;
+	}
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+	const bool bEncoded = EncodeMultiply(ComputePassEncoder, A, B, C, M, N, K);
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	Context->Submit(CommandEncoder);
+	return bEncoded;
+}
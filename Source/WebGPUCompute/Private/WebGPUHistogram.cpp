@@ -0,0 +1,225 @@
+#include "WebGPUHistogram.h"
+#include "WebGPUContext.h"
+
+namespace
+{
+	//SCALAR_T is substituted per type, BIN_SOURCE maps an in-range value to its bin
+	const char* HistogramSourceTemplate = (R"(
+struct Params {
+	count: u32,
+	num_bins: u32,
+	min_bits: u32,
+	max_bits: u32,
+	scale: f32,
+	width: u32,
+	pad0: u32,
+	pad1: u32,
+}
+
+const WG: u32 = 256u;
+
+@group(0) @binding(0) var<storage, read> src: array<SCALAR_T>;
+@group(0) @binding(1) var<storage, read_write> bins: array<atomic<u32>>;
+@group(1) @binding(0) var<uniform> params: Params;
+
+var<workgroup> local_bins: array<atomic<u32>, 4096>;
+
+fn bin_of(v: SCALAR_T) -> u32 {
+	BIN_SOURCE
+}
+
+@compute
+@workgroup_size(256)
+fn clear_bins(@builtin(global_invocation_id) gid: vec3<u32>) {
+	if (gid.x < params.num_bins) {
+		atomicStore(&bins[gid.x], 0u);
+	}
+}
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let stride = nwg.x * WG;
+	var k = wid.x * WG + lid;
+	if (k < params.count) {
+		loop {
+			let bin = bin_of(src[k]);
+			if (bin < params.num_bins) {
+				atomicAdd(&local_bins[bin], 1u);
+			}
+			// stride step without wrapping past count
+			if (params.count - k <= stride) {
+				break;
+			}
+			k += stride;
+		}
+	}
+	workgroupBarrier();
+
+	// one global atomic per non-empty bin and workgroup
+	for (var b = lid; b < params.num_bins; b += WG) {
+		let n = atomicLoad(&local_bins[b]);
+		if (n > 0u) {
+			atomicAdd(&bins[b], n);
+		}
+	}
+}
+		)");
+
+	//Out of range returns an index past num_bins so the caller skips it
+	const TCHAR* FloatBinSource = TEXT(
+		"let lo = bitcast<f32>(params.min_bits);\n"
+		"\tlet hi = bitcast<f32>(params.max_bits);\n"
+		"\tif (!(v >= lo && v <= hi)) {\n"
+		"\t\treturn 0xffffffffu;\n"
+		"\t}\n"
+		"\treturn min(u32((v - lo) * params.scale), params.num_bins - 1u);");
+
+	const TCHAR* IntBinSource = TEXT(
+		"let lo = bitcast<SCALAR_T>(params.min_bits);\n"
+		"\tlet hi = bitcast<SCALAR_T>(params.max_bits);\n"
+		"\tif (v < lo || v > hi) {\n"
+		"\t\treturn 0xffffffffu;\n"
+		"\t}\n"
+		"\treturn min(bitcast<u32>(v - lo) / params.width, params.num_bins - 1u);");
+}
+
+FWebGPUHistogram::~FWebGPUHistogram()
+{
+	Release();
+}
+
+bool FWebGPUHistogram::Initialize(FWebGPUContext& InContext)
+{
+	Release();
+
+	Context = &InContext;
+	return true;
+}
+
+void FWebGPUHistogram::Release()
+{
+	for (FHistogramKernels& TypeKernels : Kernels)
+	{
+		TypeKernels.Clear.Release();
+		TypeKernels.Count.Release();
+	}
+
+	if (ScratchBins)
+	{
+		wgpuBufferRelease(ScratchBins);
+		ScratchBins = nullptr;
+	}
+
+	Context = nullptr;
+}
+
+FWebGPUHistogram::FHistogramKernels* FWebGPUHistogram::GetKernels(EWebGPUScalarType Type)
+{
+	FHistogramKernels& TypeKernels = Kernels[(int32)Type];
+	if (TypeKernels.Count.IsValid())
+	{
+		return &TypeKernels;
+	}
+
+	FString Source(HistogramSourceTemplate);
+	Source.ReplaceInline(TEXT("BIN_SOURCE"), Type == EWebGPUScalarType::Float ? FloatBinSource : IntBinSource);
+	Source.ReplaceInline(TEXT("SCALAR_T"), Type == EWebGPUScalarType::Float ? TEXT("f32") : Type == EWebGPUScalarType::Int32 ? TEXT("i32") : TEXT("u32"));
+
+	const TArray<WGPUBufferBindingType> Bindings = { WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_Storage };
+	if (!TypeKernels.Clear.Create(*Context, Source, Bindings, true, "clear_bins") ||
+		!TypeKernels.Count.Create(*Context, Source, Bindings, true, "main"))
+	{
+		TypeKernels.Clear.Release();
+		TypeKernels.Count.Release();
+		return nullptr;
+	}
+	return &TypeKernels;
+}
+
+bool FWebGPUHistogram::EncodeHistogram(WGPUComputePassEncoder Pass, WGPUBuffer Input, uint32 Count, EWebGPUScalarType Type,
+	uint32 NumBins, double MinValue, double MaxValue, WGPUBuffer Bins)
+{
+	if (!IsInitialized() || NumBins == 0 || NumBins > MaxBins || !(MaxValue >= MinValue))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Invalid histogram setup: %u bins over [%f, %f]"), NumBins, MinValue, MaxValue);
+		return false;
+	}
+
+	FHistogramKernels* TypeKernels = GetKernels(Type);
+	if (!TypeKernels)
+	{
+		return false;
+	}
+
+	FHistogramParams Params = {};
+	Params.Count = Count;
+	Params.NumBins = NumBins;
+
+	if (Type == EWebGPUScalarType::Float)
+	{
+		const float Min = (float)MinValue;
+		const float Max = (float)MaxValue;
+		FMemory::Memcpy(&Params.MinBits, &Min, sizeof(Min));
+		FMemory::Memcpy(&Params.MaxBits, &Max, sizeof(Max));
+		Params.Scale = MaxValue > MinValue ? (float)(NumBins / (MaxValue - MinValue)) : 0.0f;
+	}
+	else
+	{
+		//Inclusive integer range, split into equal integer widths
+		const bool bSigned = Type == EWebGPUScalarType::Int32;
+		const int64 Min = bSigned ? FMath::Clamp<int64>((int64)MinValue, MIN_int32, MAX_int32) : FMath::Clamp<int64>((int64)MinValue, 0, MAX_uint32);
+		const int64 Max = bSigned ? FMath::Clamp<int64>((int64)MaxValue, MIN_int32, MAX_int32) : FMath::Clamp<int64>((int64)MaxValue, 0, MAX_uint32);
+		const uint64 Range = (uint64)(Max - Min) + 1;
+
+		Params.MinBits = (uint32)Min;
+		Params.MaxBits = (uint32)Max;
+		Params.Width = (uint32)FMath::Clamp<uint64>((Range + NumBins - 1) / NumBins, 1, MAX_uint32);
+	}
+
+	WGPUBindGroup BindGroup = TypeKernels->Count.CreateBindGroup({ Input, Bins });
+
+	bool bDispatched = TypeKernels->Clear.Dispatch(Pass, BindGroup, Params, FMath::DivideAndRoundUp(NumBins, WorkgroupSize));
+
+	if (bDispatched && Count > 0)
+	{
+		const uint32 Groups = FMath::Min(FMath::DivideAndRoundUp(Count, WorkgroupSize * ItemsPerThread), Context->GetMaxWorkgroupsPerDimension());
+		bDispatched = TypeKernels->Count.Dispatch(Pass, BindGroup, Params, Groups);
+	}
+
+	wgpuBindGroupRelease(BindGroup);
+	return bDispatched;
+}
+
+bool FWebGPUHistogram::Histogram(WGPUBuffer Input, uint32 Count, EWebGPUScalarType Type, uint32 NumBins, double MinValue, double MaxValue, TArray<uint32>& OutBins)
+{
+	if (!IsInitialized())
+	{
+		return false;
+	}
+
+	if (!ScratchBins)
+	{
+		ScratchBins = Context->CreateBuffer((uint64)MaxBins * sizeof(uint32), WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc, "histogram_bins_buffer");
+	}
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+	const bool bEncoded = EncodeHistogram(ComputePassEncoder, Input, Count, Type, NumBins, MinValue, MaxValue, ScratchBins);
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	Context->Submit(CommandEncoder);
+
+	if (!bEncoded)
+	{
+		return false;
+	}
+
+	OutBins.SetNumUninitialized(NumBins);
+	return Context->ReadBufferSync(ScratchBins, 0, (uint64)NumBins * sizeof(uint32), OutBins.GetData());
+}
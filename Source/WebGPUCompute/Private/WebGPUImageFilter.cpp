@@ -0,0 +1,490 @@
+#include "WebGPUImageFilter.h"
+#include "WebGPUContext.h"
+
+namespace
+{
+	//LOAD_DECL / STORE_DECL bind binding 0 / 1 as a buffer or texture and define load_px / store_px
+	const char* FilterCommonSource = (R"(
+struct Params {
+	width: u32,
+	height: u32,
+	radius: u32,
+	out_width: u32,
+}
+
+@group(1) @binding(0) var<uniform> params: Params;
+
+LOAD_DECL
+STORE_DECL
+
+fn load_clamped(x: i32, y: i32) -> f32 {
+	return load_px(clamp(x, 0, i32(params.width) - 1), clamp(y, 0, i32(params.height) - 1));
+}
+		)");
+
+	const TCHAR* BufferLoadDecl = TEXT(
+		"@group(0) @binding(0) var<storage, read> src: array<f32>;\n"
+		"fn load_px(x: i32, y: i32) -> f32 {\n"
+		"\treturn src[u32(y) * params.width + u32(x)];\n"
+		"}\n");
+
+	const TCHAR* TextureLoadDecl = TEXT(
+		"@group(0) @binding(0) var src: texture_2d<f32>;\n"
+		"fn load_px(x: i32, y: i32) -> f32 {\n"
+		"\treturn textureLoad(src, vec2<i32>(x, y), 0).x;\n"
+		"}\n");
+
+	const TCHAR* BufferStoreDecl = TEXT(
+		"@group(0) @binding(1) var<storage, read_write> dst: array<f32>;\n"
+		"fn store_px(x: u32, y: u32, v: f32) {\n"
+		"\tdst[y * params.out_width + x] = v;\n"
+		"}\n");
+
+	const TCHAR* TextureStoreDecl = TEXT(
+		"@group(0) @binding(1) var dst: texture_storage_2d<r32float, write>;\n"
+		"fn store_px(x: u32, y: u32, v: f32) {\n"
+		"\ttextureStore(dst, vec2<u32>(x, y), vec4<f32>(v, 0.0, 0.0, 1.0));\n"
+		"}\n");
+
+	const char* ConvolveRowsSource = (R"(
+@group(0) @binding(2) var<storage, read> weights: array<f32>;
+
+const TILE: u32 = 256u;
+
+// tile plus a radius wide halo on both sides
+var<workgroup> row: array<f32, 384>;
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>) {
+	let y = i32(wid.y);
+	let x0 = i32(wid.x * TILE) - i32(params.radius);
+	let span = TILE + 2u * params.radius;
+	for (var i = lid; i < span; i += TILE) {
+		row[i] = load_clamped(x0 + i32(i), y);
+	}
+	workgroupBarrier();
+
+	let x = wid.x * TILE + lid;
+	if (x < params.width) {
+		var acc = 0.0;
+		for (var k = 0u; k <= 2u * params.radius; k++) {
+			acc = fma(weights[k], row[lid + k], acc);
+		}
+		store_px(x, wid.y, acc);
+	}
+}
+		)");
+
+	const char* ConvolveColumnsSource = (R"(
+@group(0) @binding(2) var<storage, read> weights: array<f32>;
+
+const TW: u32 = 16u;
+const TH: u32 = 64u;
+
+// 16 columns of 64 rows plus halo, row-major so loads stay coalesced
+var<workgroup> tile: array<f32, 3072>;
+
+@compute
+@workgroup_size(16, 16)
+fn main(@builtin(local_invocation_id) lid: vec3<u32>,
+	@builtin(local_invocation_index) lindex: u32,
+	@builtin(workgroup_id) wid: vec3<u32>) {
+	let y0 = i32(wid.y * TH) - i32(params.radius);
+	let rows = TH + 2u * params.radius;
+	for (var i = lindex; i < rows * TW; i += TW * 16u) {
+		tile[i] = load_clamped(i32(wid.x * TW + i % TW), y0 + i32(i / TW));
+	}
+	workgroupBarrier();
+
+	let x = wid.x * TW + lid.x;
+	if (x >= params.width) {
+		return;
+	}
+	for (var j = 0u; j < TH / 16u; j++) {
+		let ly = lid.y + j * 16u;
+		let y = wid.y * TH + ly;
+		if (y < params.height) {
+			var acc = 0.0;
+			for (var k = 0u; k <= 2u * params.radius; k++) {
+				acc = fma(weights[k], tile[(ly + k) * TW + lid.x], acc);
+			}
+			store_px(x, y, acc);
+		}
+	}
+}
+		)");
+
+	//Running sums: add the sample entering the window, drop the one leaving it
+	const char* BoxRowsSource = (R"(
+@compute
+@workgroup_size(64)
+fn main(@builtin(global_invocation_id) gid: vec3<u32>) {
+	let y = gid.x;
+	if (y >= params.height) {
+		return;
+	}
+	let r = i32(params.radius);
+	let scale = 1.0 / f32(2u * params.radius + 1u);
+
+	var sum = 0.0;
+	for (var i = -r; i <= r; i++) {
+		sum += load_clamped(i, i32(y));
+	}
+	for (var x = 0u; x < params.width; x++) {
+		store_px(x, y, sum * scale);
+		sum += load_clamped(i32(x) + r + 1, i32(y)) - load_clamped(i32(x) - r, i32(y));
+	}
+}
+		)");
+
+	//Neighbouring invocations walk neighbouring columns, so every step is a coalesced row read
+	const char* BoxColumnsSource = (R"(
+@compute
+@workgroup_size(64)
+fn main(@builtin(global_invocation_id) gid: vec3<u32>) {
+	let x = gid.x;
+	if (x >= params.width) {
+		return;
+	}
+	let r = i32(params.radius);
+	let scale = 1.0 / f32(2u * params.radius + 1u);
+
+	var sum = 0.0;
+	for (var i = -r; i <= r; i++) {
+		sum += load_clamped(i32(x), i);
+	}
+	for (var y = 0u; y < params.height; y++) {
+		store_px(x, y, sum * scale);
+		sum += load_clamped(i32(x), i32(y) + r + 1) - load_clamped(i32(x), i32(y) - r);
+	}
+}
+		)");
+
+	const char* DownsampleSource = (R"(
+@compute
+@workgroup_size(16, 16)
+fn main(@builtin(global_invocation_id) gid: vec3<u32>) {
+	let out_height = (params.height + 1u) / 2u;
+	if (gid.x >= params.out_width || gid.y >= out_height) {
+		return;
+	}
+	let x = i32(gid.x * 2u);
+	let y = i32(gid.y * 2u);
+	let sum = load_clamped(x, y) + load_clamped(x + 1, y) + load_clamped(x, y + 1) + load_clamped(x + 1, y + 1);
+	store_px(gid.x, gid.y, sum * 0.25);
+}
+		)");
+
+	//Box widths for three passes whose combined variance matches Sigma (sum of uniform variances)
+	void GetBoxRadiiForGaussian(float Sigma, uint32 OutRadii[3])
+	{
+		const double Variance = (double)Sigma * Sigma;
+		int32 Lower = FMath::FloorToInt(FMath::Sqrt(12.0 * Variance / 3.0 + 1.0));
+		if (Lower % 2 == 0)
+		{
+			Lower--;
+		}
+		const int32 Upper = Lower + 2;
+		const int32 NumLower = FMath::RoundToInt((12.0 * Variance - 3.0 * Lower * Lower - 12.0 * Lower - 9.0) / (-4.0 * Lower - 4.0));
+
+		for (int32 i = 0; i < 3; i++)
+		{
+			OutRadii[i] = (uint32)(((i < NumLower ? Lower : Upper) - 1) / 2);
+		}
+	}
+}
+
+FWebGPUImageFilter::~FWebGPUImageFilter()
+{
+	Release();
+}
+
+bool FWebGPUImageFilter::Initialize(FWebGPUContext& InContext)
+{
+	Release();
+
+	Context = &InContext;
+	return true;
+}
+
+void FWebGPUImageFilter::Release()
+{
+	for (FWebGPUKernel (&Variants)[2] : Kernels)
+	{
+		Variants[0].Release();
+		Variants[1].Release();
+	}
+
+	for (FFilterWeights& Entry : WeightsCache)
+	{
+		wgpuBufferRelease(Entry.Buffer);
+	}
+	WeightsCache.Empty();
+
+	for (int32 i = 0; i < 2; i++)
+	{
+		if (Scratch[i])
+		{
+			wgpuBufferRelease(Scratch[i]);
+			Scratch[i] = nullptr;
+		}
+		ScratchCapacity[i] = 0;
+	}
+
+	Context = nullptr;
+}
+
+FWebGPUKernel* FWebGPUImageFilter::GetKernel(EFilterKernel KernelType, bool bTexture)
+{
+	FWebGPUKernel& Kernel = Kernels[KernelType][bTexture ? 1 : 0];
+	if (Kernel.IsValid())
+	{
+		return &Kernel;
+	}
+
+	const char* Sources[NumFilterKernels] = { ConvolveRowsSource, ConvolveColumnsSource, BoxRowsSource, BoxColumnsSource, DownsampleSource };
+	const bool bTextureOut = bTexture && (KernelType == ConvolveColumns || KernelType == BoxColumns);
+	const bool bTextureIn = bTexture && !bTextureOut;
+
+	FString Source = FString(FilterCommonSource) + FString(Sources[KernelType]);
+	Source.ReplaceInline(TEXT("LOAD_DECL"), bTextureIn ? TextureLoadDecl : BufferLoadDecl);
+	Source.ReplaceInline(TEXT("STORE_DECL"), bTextureOut ? TextureStoreDecl : BufferStoreDecl);
+
+	TArray<WGPUBindGroupLayoutEntry> LayoutEntries;
+	LayoutEntries.SetNumZeroed(KernelType == ConvolveRows || KernelType == ConvolveColumns ? 3 : 2);
+	for (int32 i = 0; i < LayoutEntries.Num(); i++)
+	{
+		LayoutEntries[i].binding = i;
+		LayoutEntries[i].visibility = WGPUShaderStage_Compute;
+		LayoutEntries[i].buffer.type = i == 1 ? WGPUBufferBindingType_Storage : WGPUBufferBindingType_ReadOnlyStorage;
+	}
+	if (bTextureIn)
+	{
+		LayoutEntries[0].buffer.type = WGPUBufferBindingType_BindingNotUsed;
+		LayoutEntries[0].texture.sampleType = WGPUTextureSampleType_UnfilterableFloat;
+		LayoutEntries[0].texture.viewDimension = WGPUTextureViewDimension_2D;
+	}
+	if (bTextureOut)
+	{
+		LayoutEntries[1].buffer.type = WGPUBufferBindingType_BindingNotUsed;
+		LayoutEntries[1].storageTexture.access = WGPUStorageTextureAccess_WriteOnly;
+		LayoutEntries[1].storageTexture.format = WGPUTextureFormat_R32Float;
+		LayoutEntries[1].storageTexture.viewDimension = WGPUTextureViewDimension_2D;
+	}
+
+	if (!Kernel.CreateWithLayout(*Context, Source, LayoutEntries, true))
+	{
+		return nullptr;
+	}
+	return &Kernel;
+}
+
+WGPUBuffer FWebGPUImageFilter::GetWeightsBuffer(const TArray<float>& Weights)
+{
+	for (int32 i = 0; i < WeightsCache.Num(); i++)
+	{
+		if (WeightsCache[i].Weights == Weights)
+		{
+			//Move to the back so it is the last one evicted
+			FFilterWeights Hit = MoveTemp(WeightsCache[i]);
+			WeightsCache.RemoveAt(i);
+			return WeightsCache.Add_GetRef(MoveTemp(Hit)).Buffer;
+		}
+	}
+
+	//Bind groups already recorded with the evicted buffer keep their own reference until they're done
+	if (WeightsCache.Num() >= MaxCachedWeights)
+	{
+		wgpuBufferRelease(WeightsCache[0].Buffer);
+		WeightsCache.RemoveAt(0);
+	}
+
+	FFilterWeights& Entry = WeightsCache.AddDefaulted_GetRef();
+	Entry.Weights = Weights;
+	Entry.Buffer = Context->CreateBuffer((uint64)Weights.Num() * sizeof(float), WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst, "filter_weights_buffer");
+	wgpuQueueWriteBuffer(Context->Queue, Entry.Buffer, 0, Weights.GetData(), (uint64)Weights.Num() * sizeof(float));
+	return Entry.Buffer;
+}
+
+WGPUBuffer FWebGPUImageFilter::GetScratch(int32 Index, uint64 NumPixels)
+{
+	return Context->EnsureScratchBuffer(Scratch[Index], ScratchCapacity[Index], NumPixels * sizeof(float), WGPUBufferUsage_Storage, "filter_scratch_buffer");
+}
+
+WGPUBindGroupEntry FWebGPUImageFilter::MakeEntry(uint32 Binding, const FWebGPUImage& Image) const
+{
+	WGPUBindGroupEntry Entry = {};
+	Entry.binding = Binding;
+	if (Image.IsTexture())
+	{
+		Entry.textureView = Image.Texture;
+	}
+	else
+	{
+		Entry.buffer = Image.Buffer;
+		Entry.size = wgpuBufferGetSize(Image.Buffer);
+	}
+	return Entry;
+}
+
+bool FWebGPUImageFilter::EncodePass(WGPUComputePassEncoder Pass, EFilterKernel KernelType, const FWebGPUImage& Input, const FWebGPUImage& Output,
+	const FFilterParams& Params, WGPUBuffer Weights, uint32 GroupsX, uint32 GroupsY)
+{
+	FWebGPUKernel* Kernel = GetKernel(KernelType, Input.IsTexture() || Output.IsTexture());
+	if (!Kernel)
+	{
+		return false;
+	}
+
+	TArray<WGPUBindGroupEntry> Entries = { MakeEntry(0, Input), MakeEntry(1, Output) };
+	if (Weights)
+	{
+		Entries.Add(MakeEntry(2, FWebGPUImage::FromBuffer(Weights)));
+	}
+
+	WGPUBindGroup BindGroup = Kernel->CreateBindGroup(Entries);
+	const bool bDispatched = Kernel->Dispatch(Pass, BindGroup, Params, GroupsX, GroupsY);
+	wgpuBindGroupRelease(BindGroup);
+	return bDispatched;
+}
+
+bool FWebGPUImageFilter::EncodeSeparable(WGPUComputePassEncoder Pass, const FWebGPUImage& Input, const FWebGPUImage& Output, uint32 Width, uint32 Height,
+	const TArray<float>& WeightsX, const TArray<float>& WeightsY)
+{
+	auto IsValidKernel = [](const TArray<float>& Weights)
+	{
+		return Weights.Num() % 2 == 1 && Weights.Num() <= (int32)(2 * MaxRadius + 1);
+	};
+
+	if (!IsInitialized() || !Input.IsValid() || !Output.IsValid() || Width == 0 || Height == 0 || !IsValidKernel(WeightsX) || !IsValidKernel(WeightsY))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Invalid separable filter: %ux%u with %d x %d taps (max radius %u)"), Width, Height, WeightsX.Num(), WeightsY.Num(), MaxRadius);
+		return false;
+	}
+
+	const FWebGPUImage Rows = FWebGPUImage::FromBuffer(GetScratch(0, (uint64)Width * Height));
+
+	FFilterParams Params = { Width, Height, (uint32)WeightsX.Num() / 2, Width };
+	if (!EncodePass(Pass, ConvolveRows, Input, Rows, Params, GetWeightsBuffer(WeightsX), FMath::DivideAndRoundUp(Width, RowTile), Height))
+	{
+		return false;
+	}
+
+	Params.Radius = (uint32)WeightsY.Num() / 2;
+	return EncodePass(Pass, ConvolveColumns, Rows, Output, Params, GetWeightsBuffer(WeightsY),
+		FMath::DivideAndRoundUp(Width, ColumnTileWidth), FMath::DivideAndRoundUp(Height, ColumnTileHeight));
+}
+
+bool FWebGPUImageFilter::EncodeBoxBlur(WGPUComputePassEncoder Pass, const FWebGPUImage& Input, const FWebGPUImage& Output, uint32 Width, uint32 Height, uint32 Radius)
+{
+	if (!IsInitialized() || !Input.IsValid() || !Output.IsValid() || Width == 0 || Height == 0)
+	{
+		return false;
+	}
+
+	const FWebGPUImage Rows = FWebGPUImage::FromBuffer(GetScratch(0, (uint64)Width * Height));
+
+	const FFilterParams Params = { Width, Height, Radius, Width };
+	return EncodePass(Pass, BoxRows, Input, Rows, Params, nullptr, FMath::DivideAndRoundUp(Height, 64u), 1) &&
+		EncodePass(Pass, BoxColumns, Rows, Output, Params, nullptr, FMath::DivideAndRoundUp(Width, 64u), 1);
+}
+
+bool FWebGPUImageFilter::EncodeGaussianBlur(WGPUComputePassEncoder Pass, const FWebGPUImage& Input, const FWebGPUImage& Output, uint32 Width, uint32 Height, float Sigma)
+{
+	if (!(Sigma > 0.0f))
+	{
+		return false;
+	}
+
+	const TArray<float> Weights = MakeGaussianWeights(Sigma);
+	if (Weights.Num() <= (int32)(2 * MaxRadius + 1))
+	{
+		return EncodeSeparable(Pass, Input, Output, Width, Height, Weights, Weights);
+	}
+
+	//Three box blurs converge on the Gaussian and don't care about the radius
+	uint32 Radii[3];
+	GetBoxRadiiForGaussian(Sigma, Radii);
+
+	const FWebGPUImage Blurred = FWebGPUImage::FromBuffer(GetScratch(1, (uint64)Width * Height));
+	return EncodeBoxBlur(Pass, Input, Blurred, Width, Height, Radii[0]) &&
+		EncodeBoxBlur(Pass, Blurred, Blurred, Width, Height, Radii[1]) &&
+		EncodeBoxBlur(Pass, Blurred, Output, Width, Height, Radii[2]);
+}
+
+bool FWebGPUImageFilter::EncodeDownsample(WGPUComputePassEncoder Pass, const FWebGPUImage& Input, WGPUBuffer Output, uint32 Width, uint32 Height)
+{
+	if (!IsInitialized() || !Input.IsValid() || !Output || Width == 0 || Height == 0)
+	{
+		return false;
+	}
+
+	const uint32 OutWidth = (Width + 1) / 2;
+	const uint32 OutHeight = (Height + 1) / 2;
+	const FFilterParams Params = { Width, Height, 0, OutWidth };
+	return EncodePass(Pass, Downsample, Input, FWebGPUImage::FromBuffer(Output), Params, nullptr,
+		FMath::DivideAndRoundUp(OutWidth, 16u), FMath::DivideAndRoundUp(OutHeight, 16u));
+}
+
+bool FWebGPUImageFilter::EncodePyramid(WGPUComputePassEncoder Pass, const FWebGPUImage& Input, uint32 Width, uint32 Height, const TArray<WGPUBuffer>& Levels)
+{
+	FWebGPUImage Source = Input;
+	for (int32 Level = 0; Level < Levels.Num(); Level++)
+	{
+		if (!EncodeDownsample(Pass, Source, Levels[Level], Width, Height))
+		{
+			return false;
+		}
+		Source = FWebGPUImage::FromBuffer(Levels[Level]);
+		Width = (Width + 1) / 2;
+		Height = (Height + 1) / 2;
+	}
+	return true;
+}
+
+TArray<WGPUBuffer> FWebGPUImageFilter::CreatePyramidBuffers(uint32 Width, uint32 Height, int32 NumLevels) const
+{
+	TArray<WGPUBuffer> Levels;
+	for (int32 Level = 0; Level < NumLevels; Level++)
+	{
+		uint32 LevelWidth, LevelHeight;
+		GetPyramidLevelSize(Width, Height, Level + 1, LevelWidth, LevelHeight);
+		Levels.Add(Context->CreateBuffer((uint64)LevelWidth * LevelHeight * sizeof(float),
+			WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc | WGPUBufferUsage_CopyDst, "pyramid_level_buffer"));
+	}
+	return Levels;
+}
+
+void FWebGPUImageFilter::GetPyramidLevelSize(uint32 Width, uint32 Height, int32 Level, uint32& OutWidth, uint32& OutHeight)
+{
+	OutWidth = Width;
+	OutHeight = Height;
+	for (int32 i = 0; i < Level; i++)
+	{
+		OutWidth = (OutWidth + 1) / 2;
+		OutHeight = (OutHeight + 1) / 2;
+	}
+}
+
+TArray<float> FWebGPUImageFilter::MakeGaussianWeights(float Sigma)
+{
+	const int32 Radius = FMath::Max(FMath::CeilToInt(3.0f * Sigma), 1);
+
+	TArray<float> Weights;
+	Weights.SetNumUninitialized(2 * Radius + 1);
+
+	double Sum = 0.0;
+	for (int32 i = -Radius; i <= Radius; i++)
+	{
+		const double Weight = FMath::Exp(-(double)(i * i) / (2.0 * Sigma * Sigma));
+		Weights[i + Radius] = (float)Weight;
+		Sum += Weight;
+	}
+	for (float& Weight : Weights)
+	{
+		Weight = (float)(Weight / Sum);
+	}
+	return Weights;
+}
@@ -0,0 +1,80 @@
+#include "WebGPUIndirectDispatch.h"
+#include "WebGPUContext.h"
+
+namespace
+{
+	struct FCountToArgsParams
+	{
+		uint32 CountIndex;
+		uint32 ArgsIndex;
+		uint32 WorkgroupSize;
+		uint32 MaxPerDimension;
+	};
+
+	const char* CountToArgsSource = (R"(
+struct Params {
+	count_index: u32,
+	args_index: u32,
+	workgroup_size: u32,
+	max_per_dimension: u32,
+}
+
+@group(0) @binding(0) var<storage, read> counts: array<u32>;
+@group(0) @binding(1) var<storage, read_write> args: array<u32>;
+@group(1) @binding(0) var<uniform> params: Params;
+
+@compute
+@workgroup_size(1)
+fn main() {
+	let count = counts[params.count_index];
+
+	// ceil without the count + size - 1 overflow
+	let groups = count / params.workgroup_size + select(0u, 1u, count % params.workgroup_size != 0u);
+	let x = min(groups, params.max_per_dimension);
+	var y = 1u;
+	if (x > 0u) {
+		y = groups / x + select(0u, 1u, groups % x != 0u);
+	}
+
+	args[params.args_index] = x;
+	args[params.args_index + 1u] = y;
+	args[params.args_index + 2u] = 1u;
+}
+		)");
+}
+
+bool FWebGPUIndirectDispatch::Initialize(FWebGPUContext& InContext)
+{
+	Context = &InContext;
+
+	return CountToArgsKernel.Create(*Context, FString(CountToArgsSource),
+		{ WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_Storage }, true);
+}
+
+void FWebGPUIndirectDispatch::Release()
+{
+	CountToArgsKernel.Release();
+	Context = nullptr;
+}
+
+WGPUBuffer FWebGPUIndirectDispatch::CreateArgsBuffer(uint32 NumEntries) const
+{
+	return Context->CreateBuffer((uint64)ArgsStride * FMath::Max(NumEntries, 1u),
+		WGPUBufferUsage_Storage | WGPUBufferUsage_Indirect | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "indirect_args_buffer");
+}
+
+bool FWebGPUIndirectDispatch::EncodeCountToArgs(WGPUComputePassEncoder Pass, WGPUBuffer CountBuffer, uint32 CountIndex, uint32 WorkgroupSize, WGPUBuffer ArgsBuffer, uint32 ArgsEntry) const
+{
+	FCountToArgsParams Params;
+	Params.CountIndex = CountIndex;
+	Params.ArgsIndex = ArgsEntry * 3;
+	Params.WorkgroupSize = FMath::Max(WorkgroupSize, 1u);
+	Params.MaxPerDimension = Context->GetMaxWorkgroupsPerDimension();
+
+	//Compute pass dispatches are separate usage scopes, so the args written here are
+	//visible to a DispatchWorkgroupsIndirect later in the same pass
+	WGPUBindGroup BindGroup = CountToArgsKernel.CreateBindGroup({ CountBuffer, ArgsBuffer });
+	const bool bDispatched = CountToArgsKernel.Dispatch(Pass, BindGroup, Params, 1);
+	wgpuBindGroupRelease(BindGroup);
+	return bDispatched;
+}
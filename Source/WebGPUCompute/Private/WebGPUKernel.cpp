@@ -0,0 +1,159 @@
+#include "WebGPUKernel.h"
+#include "WebGPUContext.h"
+
+FWebGPUKernel::~FWebGPUKernel()
+{
+	Release();
+}
+
+bool FWebGPUKernel::Create(FWebGPUContext& InContext, const FString& Source, const TArray<WGPUBufferBindingType>& InBindings, bool bInUsesParams, const char* EntryPoint, const TArray<WGPUConstantEntry>& Constants)
+{
+	TArray<WGPUBindGroupLayoutEntry> LayoutEntries;
+	LayoutEntries.SetNumZeroed(InBindings.Num());
+	for (int32 i = 0; i < InBindings.Num(); i++)
+	{
+		LayoutEntries[i].binding = i;
+		LayoutEntries[i].visibility = WGPUShaderStage_Compute;
+		LayoutEntries[i].buffer.type = InBindings[i];
+	}
+
+	return CreateWithLayout(InContext, Source, LayoutEntries, bInUsesParams, EntryPoint, Constants);
+}
+
+bool FWebGPUKernel::CreateWithLayout(FWebGPUContext& InContext, const FString& Source, const TArray<WGPUBindGroupLayoutEntry>& LayoutEntries, bool bInUsesParams, const char* EntryPoint, const TArray<WGPUConstantEntry>& Constants)
+{
+	Release();
+
+	Context = &InContext;
+	NumBindings = LayoutEntries.Num();
+	bUsesParams = bInUsesParams;
+
+	ShaderModule = Context->CreateShaderModule(Source, EntryPoint);
+	if (!ShaderModule)
+	{
+		return false;
+	}
+
+	WGPUBindGroupLayoutDescriptor LayoutDesc = {};
+	LayoutDesc.label = { "kernel_storage_layout", WGPU_STRLEN };
+	LayoutDesc.entryCount = NumBindings;
+	LayoutDesc.entries = LayoutEntries.GetData();
+
+	BindGroupLayout = wgpuDeviceCreateBindGroupLayout(Context->Device, &LayoutDesc);
+	assert(BindGroupLayout);
+
+	WGPUBindGroupLayout GroupLayouts[2] = { BindGroupLayout, nullptr };
+	if (bUsesParams)
+	{
+		GroupLayouts[1] = Context->GetUniformRing().GetBindGroupLayout();
+	}
+
+	WGPUPipelineLayoutDescriptor PipelineLayoutDesc = {};
+	PipelineLayoutDesc.label = { "kernel_pipeline_layout", WGPU_STRLEN };
+	PipelineLayoutDesc.bindGroupLayoutCount = bUsesParams ? 2 : 1;
+	PipelineLayoutDesc.bindGroupLayouts = GroupLayouts;
+
+	PipelineLayout = wgpuDeviceCreatePipelineLayout(Context->Device, &PipelineLayoutDesc);
+	assert(PipelineLayout);
+
+	Pipeline = Context->CreateComputePipeline(ShaderModule, PipelineLayout, EntryPoint, Constants);
+	if (!Pipeline)
+	{
+		Release();
+		return false;
+	}
+	return true;
+}
+
+void FWebGPUKernel::Release()
+{
+	if (Pipeline)
+	{
+		wgpuComputePipelineRelease(Pipeline);
+		Pipeline = nullptr;
+	}
+	if (PipelineLayout)
+	{
+		wgpuPipelineLayoutRelease(PipelineLayout);
+		PipelineLayout = nullptr;
+	}
+	if (BindGroupLayout)
+	{
+		wgpuBindGroupLayoutRelease(BindGroupLayout);
+		BindGroupLayout = nullptr;
+	}
+	if (ShaderModule)
+	{
+		wgpuShaderModuleRelease(ShaderModule);
+		ShaderModule = nullptr;
+	}
+}
+
+WGPUBindGroup FWebGPUKernel::CreateBindGroup(const TArray<WGPUBuffer>& Buffers) const
+{
+	TArray<WGPUBindGroupEntry> Entries;
+	Entries.SetNumZeroed(Buffers.Num());
+	for (int32 i = 0; i < Buffers.Num(); i++)
+	{
+		Entries[i].binding = i;
+		Entries[i].buffer = Buffers[i];
+		Entries[i].offset = 0;
+		Entries[i].size = wgpuBufferGetSize(Buffers[i]);
+	}
+
+	return CreateBindGroup(Entries);
+}
+
+WGPUBindGroup FWebGPUKernel::CreateBindGroup(const TArray<WGPUBindGroupEntry>& Entries) const
+{
+	check(Entries.Num() == NumBindings);
+
+	WGPUBindGroupDescriptor BindGroupDesc = {};
+	BindGroupDesc.label = { "kernel_bind_group", WGPU_STRLEN };
+	BindGroupDesc.layout = BindGroupLayout;
+	BindGroupDesc.entryCount = Entries.Num();
+	BindGroupDesc.entries = Entries.GetData();
+
+	WGPUBindGroup BindGroup = wgpuDeviceCreateBindGroup(Context->Device, &BindGroupDesc);
+	assert(BindGroup);
+	return BindGroup;
+}
+
+bool FWebGPUKernel::Bind(WGPUComputePassEncoder Pass, WGPUBindGroup BindGroup, const void* Params, uint32 ParamsSize) const
+{
+	wgpuComputePassEncoderSetPipeline(Pass, Pipeline);
+	wgpuComputePassEncoderSetBindGroup(Pass, 0, BindGroup, 0, nullptr);
+
+	if (bUsesParams)
+	{
+		FWebGPUUniformRing& UniformRing = Context->GetUniformRing();
+
+		uint32 DynamicOffset = 0;
+		if (!UniformRing.Allocate(Params, ParamsSize, DynamicOffset))
+		{
+			return false;
+		}
+		wgpuComputePassEncoderSetBindGroup(Pass, 1, UniformRing.GetBindGroup(), 1, &DynamicOffset);
+	}
+	return true;
+}
+
+bool FWebGPUKernel::Dispatch(WGPUComputePassEncoder Pass, WGPUBindGroup BindGroup, const void* Params, uint32 ParamsSize, uint32 X, uint32 Y, uint32 Z) const
+{
+	if (!Bind(Pass, BindGroup, Params, ParamsSize))
+	{
+		return false;
+	}
+	wgpuComputePassEncoderDispatchWorkgroups(Pass, X, Y, Z);
+	return true;
+}
+
+bool FWebGPUKernel::DispatchIndirect(WGPUComputePassEncoder Pass, WGPUBindGroup BindGroup, const void* Params, uint32 ParamsSize, WGPUBuffer ArgsBuffer, uint64 ArgsOffset) const
+{
+	if (!Bind(Pass, BindGroup, Params, ParamsSize))
+	{
+		return false;
+	}
+	wgpuComputePassEncoderDispatchWorkgroupsIndirect(Pass, ArgsBuffer, ArgsOffset);
+	return true;
+}
@@ -0,0 +1,506 @@
+#include "WebGPUNoise.h"
+#include "WebGPUContext.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	//STORE_DECL binds binding 0 as a buffer or write-only texture and defines store_px.
+	//Keep in sync with the CPU reference below.
+	const char* NoiseSource = (R"(
+struct Params {
+	width: u32,
+	height: u32,
+	seed: u32,
+	octaves: u32,
+	noise_type: u32,
+	pad0: u32,
+	pad1: u32,
+	pad2: u32,
+	frequency: f32,
+	lacunarity: f32,
+	gain: f32,
+	warp: f32,
+	origin: vec4<f32>,
+}
+
+@group(1) @binding(0) var<uniform> params: Params;
+
+STORE_DECL
+
+// lowbias32
+fn hash1(x: u32) -> u32 {
+	var h = x;
+	h ^= h >> 16u;
+	h *= 0x7feb352du;
+	h ^= h >> 15u;
+	h *= 0x846ca68bu;
+	h ^= h >> 16u;
+	return h;
+}
+
+fn hash3(x: i32, y: i32, z: i32, seed: u32) -> u32 {
+	return hash1(bitcast<u32>(z) + hash1(bitcast<u32>(y) + hash1(bitcast<u32>(x) + seed)));
+}
+
+fn fade(t: f32) -> f32 {
+	return t * t * t * (t * (t * 6.0 - 15.0) + 10.0);
+}
+
+// 4 diagonal and 4 axis gradients, the axis ones scaled to the same length
+fn grad2(h: u32, x: f32, y: f32) -> f32 {
+	let sx = select(1.0, -1.0, (h & 1u) != 0u);
+	let sy = select(1.0, -1.0, (h & 2u) != 0u);
+	if ((h & 4u) == 0u) {
+		return sx * x + sy * y;
+	}
+	return select(sx * x, sx * y, (h & 2u) != 0u) * 1.41421356;
+}
+
+// the 12 cube edge gradients (plus 4 repeats)
+fn grad3(h: u32, x: f32, y: f32, z: f32) -> f32 {
+	let b = h & 15u;
+	let u = select(y, x, b < 8u);
+	let v = select(select(z, x, b == 12u || b == 14u), y, b < 4u);
+	return select(u, -u, (b & 1u) != 0u) + select(v, -v, (b & 2u) != 0u);
+}
+
+fn lerp(a: f32, b: f32, t: f32) -> f32 {
+	return a + t * (b - a);
+}
+
+fn gradient2(p: vec3<f32>, seed: u32) -> f32 {
+	let ix = floor(p.x);
+	let iy = floor(p.y);
+	let fx = p.x - ix;
+	let fy = p.y - iy;
+	let x = i32(ix);
+	let y = i32(iy);
+
+	let n00 = grad2(hash3(x, y, 0, seed), fx, fy);
+	let n10 = grad2(hash3(x + 1, y, 0, seed), fx - 1.0, fy);
+	let n01 = grad2(hash3(x, y + 1, 0, seed), fx, fy - 1.0);
+	let n11 = grad2(hash3(x + 1, y + 1, 0, seed), fx - 1.0, fy - 1.0);
+
+	let u = fade(fx);
+	return lerp(lerp(n00, n10, u), lerp(n01, n11, u), fade(fy));
+}
+
+fn gradient3(p: vec3<f32>, seed: u32) -> f32 {
+	let ix = floor(p.x);
+	let iy = floor(p.y);
+	let iz = floor(p.z);
+	let fx = p.x - ix;
+	let fy = p.y - iy;
+	let fz = p.z - iz;
+	let x = i32(ix);
+	let y = i32(iy);
+	let z = i32(iz);
+
+	let n000 = grad3(hash3(x, y, z, seed), fx, fy, fz);
+	let n100 = grad3(hash3(x + 1, y, z, seed), fx - 1.0, fy, fz);
+	let n010 = grad3(hash3(x, y + 1, z, seed), fx, fy - 1.0, fz);
+	let n110 = grad3(hash3(x + 1, y + 1, z, seed), fx - 1.0, fy - 1.0, fz);
+	let n001 = grad3(hash3(x, y, z + 1, seed), fx, fy, fz - 1.0);
+	let n101 = grad3(hash3(x + 1, y, z + 1, seed), fx - 1.0, fy, fz - 1.0);
+	let n011 = grad3(hash3(x, y + 1, z + 1, seed), fx, fy - 1.0, fz - 1.0);
+	let n111 = grad3(hash3(x + 1, y + 1, z + 1, seed), fx - 1.0, fy - 1.0, fz - 1.0);
+
+	let u = fade(fx);
+	let v = fade(fy);
+	let n0 = lerp(lerp(n000, n100, u), lerp(n010, n110, u), v);
+	let n1 = lerp(lerp(n001, n101, u), lerp(n011, n111, u), v);
+	return lerp(n0, n1, fade(fz));
+}
+
+// one feature point per cell, jittered by 16 bits of the cell hash per axis
+fn cellular2(p: vec3<f32>, seed: u32) -> f32 {
+	let ix = floor(p.x);
+	let iy = floor(p.y);
+	let fx = p.x - ix;
+	let fy = p.y - iy;
+	let x = i32(ix);
+	let y = i32(iy);
+
+	var best = 8.0;
+	for (var dy = -1; dy <= 1; dy++) {
+		for (var dx = -1; dx <= 1; dx++) {
+			let h = hash3(x + dx, y + dy, 0, seed);
+			let ox = f32(dx) + f32(h & 0xffffu) * (1.0 / 65536.0) - fx;
+			let oy = f32(dy) + f32(h >> 16u) * (1.0 / 65536.0) - fy;
+			best = min(best, ox * ox + oy * oy);
+		}
+	}
+	return sqrt(best);
+}
+
+fn base_noise(p: vec3<f32>, seed: u32) -> f32 {
+	if (params.noise_type == 1u) {
+		return gradient3(p, seed);
+	}
+	if (params.noise_type == 2u) {
+		return cellular2(p, seed);
+	}
+	return gradient2(p, seed);
+}
+
+// normalized by the amplitude sum so every octave count stays in the base noise range
+fn fbm(p: vec3<f32>, seed: u32) -> f32 {
+	var sum = 0.0;
+	var norm = 0.0;
+	var amplitude = 1.0;
+	var q = p;
+	for (var o = 0u; o < params.octaves; o++) {
+		sum += amplitude * base_noise(q, seed + o * 0x9e3779b9u);
+		norm += amplitude;
+		amplitude *= params.gain;
+		q *= params.lacunarity;
+	}
+	return sum / norm;
+}
+
+@compute
+@workgroup_size(16, 16)
+fn main(@builtin(global_invocation_id) gid: vec3<u32>) {
+	if (gid.x >= params.width || gid.y >= params.height) {
+		return;
+	}
+
+	var p = vec3<f32>((f32(gid.x) + params.origin.x) * params.frequency,
+		(f32(gid.y) + params.origin.y) * params.frequency,
+		params.origin.z * params.frequency);
+
+	if (params.warp != 0.0) {
+		let wx = fbm(p, params.seed ^ 0x68e31da4u);
+		let wy = fbm(vec3<f32>(p.x + 5.2, p.y + 1.3, p.z), params.seed ^ 0xb5297a4du);
+		p = vec3<f32>(p.x + wx * params.warp, p.y + wy * params.warp, p.z);
+	}
+
+	store_px(gid.x, gid.y, fbm(p, params.seed));
+}
+		)");
+
+	const TCHAR* BufferStoreDecl = TEXT(
+		"@group(0) @binding(0) var<storage, read_write> dst: array<f32>;\n"
+		"fn store_px(x: u32, y: u32, v: f32) {\n"
+		"\tdst[y * params.width + x] = v;\n"
+		"}\n");
+
+	const TCHAR* TextureStoreDecl = TEXT(
+		"@group(0) @binding(0) var dst: texture_storage_2d<r32float, write>;\n"
+		"fn store_px(x: u32, y: u32, v: f32) {\n"
+		"\ttextureStore(dst, vec2<u32>(x, y), vec4<f32>(v, 0.0, 0.0, 1.0));\n"
+		"}\n");
+
+	//CPU mirror of the shader above
+	uint32 Hash(uint32 X)
+	{
+		uint32 H = X;
+		H ^= H >> 16;
+		H *= 0x7feb352du;
+		H ^= H >> 15;
+		H *= 0x846ca68bu;
+		H ^= H >> 16;
+		return H;
+	}
+
+	uint32 Hash3(int32 X, int32 Y, int32 Z, uint32 Seed)
+	{
+		return Hash((uint32)Z + Hash((uint32)Y + Hash((uint32)X + Seed)));
+	}
+
+	float Fade(float T)
+	{
+		return T * T * T * (T * (T * 6.f - 15.f) + 10.f);
+	}
+
+	float Grad2(uint32 H, float X, float Y)
+	{
+		const float SX = (H & 1) ? -1.f : 1.f;
+		const float SY = (H & 2) ? -1.f : 1.f;
+		if ((H & 4) == 0)
+		{
+			return SX * X + SY * Y;
+		}
+		return ((H & 2) ? SX * Y : SX * X) * 1.41421356f;
+	}
+
+	float Grad3(uint32 H, float X, float Y, float Z)
+	{
+		const uint32 B = H & 15;
+		const float U = B < 8 ? X : Y;
+		const float V = B < 4 ? Y : (B == 12 || B == 14 ? X : Z);
+		return ((B & 1) ? -U : U) + ((B & 2) ? -V : V);
+	}
+
+	float Lerp(float A, float B, float T)
+	{
+		return A + T * (B - A);
+	}
+
+	float Gradient2(float PX, float PY, uint32 Seed)
+	{
+		const float IX = FMath::FloorToFloat(PX);
+		const float IY = FMath::FloorToFloat(PY);
+		const float FX = PX - IX;
+		const float FY = PY - IY;
+		const int32 X = (int32)IX;
+		const int32 Y = (int32)IY;
+
+		const float N00 = Grad2(Hash3(X, Y, 0, Seed), FX, FY);
+		const float N10 = Grad2(Hash3(X + 1, Y, 0, Seed), FX - 1.f, FY);
+		const float N01 = Grad2(Hash3(X, Y + 1, 0, Seed), FX, FY - 1.f);
+		const float N11 = Grad2(Hash3(X + 1, Y + 1, 0, Seed), FX - 1.f, FY - 1.f);
+
+		const float U = Fade(FX);
+		return Lerp(Lerp(N00, N10, U), Lerp(N01, N11, U), Fade(FY));
+	}
+
+	float Gradient3(float PX, float PY, float PZ, uint32 Seed)
+	{
+		const float IX = FMath::FloorToFloat(PX);
+		const float IY = FMath::FloorToFloat(PY);
+		const float IZ = FMath::FloorToFloat(PZ);
+		const float FX = PX - IX;
+		const float FY = PY - IY;
+		const float FZ = PZ - IZ;
+		const int32 X = (int32)IX;
+		const int32 Y = (int32)IY;
+		const int32 Z = (int32)IZ;
+
+		const float N000 = Grad3(Hash3(X, Y, Z, Seed), FX, FY, FZ);
+		const float N100 = Grad3(Hash3(X + 1, Y, Z, Seed), FX - 1.f, FY, FZ);
+		const float N010 = Grad3(Hash3(X, Y + 1, Z, Seed), FX, FY - 1.f, FZ);
+		const float N110 = Grad3(Hash3(X + 1, Y + 1, Z, Seed), FX - 1.f, FY - 1.f, FZ);
+		const float N001 = Grad3(Hash3(X, Y, Z + 1, Seed), FX, FY, FZ - 1.f);
+		const float N101 = Grad3(Hash3(X + 1, Y, Z + 1, Seed), FX - 1.f, FY, FZ - 1.f);
+		const float N011 = Grad3(Hash3(X, Y + 1, Z + 1, Seed), FX, FY - 1.f, FZ - 1.f);
+		const float N111 = Grad3(Hash3(X + 1, Y + 1, Z + 1, Seed), FX - 1.f, FY - 1.f, FZ - 1.f);
+
+		const float U = Fade(FX);
+		const float V = Fade(FY);
+		const float N0 = Lerp(Lerp(N000, N100, U), Lerp(N010, N110, U), V);
+		const float N1 = Lerp(Lerp(N001, N101, U), Lerp(N011, N111, U), V);
+		return Lerp(N0, N1, Fade(FZ));
+	}
+
+	float Cellular2(float PX, float PY, uint32 Seed)
+	{
+		const float IX = FMath::FloorToFloat(PX);
+		const float IY = FMath::FloorToFloat(PY);
+		const float FX = PX - IX;
+		const float FY = PY - IY;
+		const int32 X = (int32)IX;
+		const int32 Y = (int32)IY;
+
+		float Best = 8.f;
+		for (int32 DY = -1; DY <= 1; DY++)
+		{
+			for (int32 DX = -1; DX <= 1; DX++)
+			{
+				const uint32 H = Hash3(X + DX, Y + DY, 0, Seed);
+				const float OX = (float)DX + (float)(H & 0xffff) * (1.f / 65536.f) - FX;
+				const float OY = (float)DY + (float)(H >> 16) * (1.f / 65536.f) - FY;
+				Best = FMath::Min(Best, OX * OX + OY * OY);
+			}
+		}
+		return FMath::Sqrt(Best);
+	}
+
+	float BaseNoise(EWebGPUNoiseType Type, float PX, float PY, float PZ, uint32 Seed)
+	{
+		switch (Type)
+		{
+		case EWebGPUNoiseType::Gradient3D:
+			return Gradient3(PX, PY, PZ, Seed);
+		case EWebGPUNoiseType::Cellular2D:
+			return Cellular2(PX, PY, Seed);
+		default:
+			return Gradient2(PX, PY, Seed);
+		}
+	}
+
+	float Fbm(const FWebGPUNoiseSettings& Settings, int32 Octaves, float PX, float PY, float PZ, uint32 Seed)
+	{
+		float Sum = 0.f;
+		float Norm = 0.f;
+		float Amplitude = 1.f;
+		for (int32 o = 0; o < Octaves; o++)
+		{
+			Sum += Amplitude * BaseNoise(Settings.Type, PX, PY, PZ, Seed + (uint32)o * 0x9e3779b9u);
+			Norm += Amplitude;
+			Amplitude *= Settings.Gain;
+			PX *= Settings.Lacunarity;
+			PY *= Settings.Lacunarity;
+			PZ *= Settings.Lacunarity;
+		}
+		return Sum / Norm;
+	}
+}
+
+FWebGPUNoise::~FWebGPUNoise()
+{
+	Release();
+}
+
+bool FWebGPUNoise::Initialize(FWebGPUContext& InContext)
+{
+	Release();
+
+	Context = &InContext;
+	return true;
+}
+
+void FWebGPUNoise::Release()
+{
+	Kernels[0].Release();
+	Kernels[1].Release();
+
+	if (Scratch)
+	{
+		wgpuBufferRelease(Scratch);
+		Scratch = nullptr;
+	}
+	ScratchCapacity = 0;
+
+	Context = nullptr;
+}
+
+FWebGPUKernel* FWebGPUNoise::GetKernel(bool bTexture)
+{
+	FWebGPUKernel& Kernel = Kernels[bTexture ? 1 : 0];
+	if (Kernel.IsValid())
+	{
+		return &Kernel;
+	}
+
+	FString Source = FString(NoiseSource);
+	Source.ReplaceInline(TEXT("STORE_DECL"), bTexture ? TextureStoreDecl : BufferStoreDecl);
+
+	TArray<WGPUBindGroupLayoutEntry> LayoutEntries;
+	LayoutEntries.SetNumZeroed(1);
+	LayoutEntries[0].binding = 0;
+	LayoutEntries[0].visibility = WGPUShaderStage_Compute;
+	if (bTexture)
+	{
+		LayoutEntries[0].storageTexture.access = WGPUStorageTextureAccess_WriteOnly;
+		LayoutEntries[0].storageTexture.format = WGPUTextureFormat_R32Float;
+		LayoutEntries[0].storageTexture.viewDimension = WGPUTextureViewDimension_2D;
+	}
+	else
+	{
+		LayoutEntries[0].buffer.type = WGPUBufferBindingType_Storage;
+	}
+
+	if (!Kernel.CreateWithLayout(*Context, Source, LayoutEntries, true))
+	{
+		return nullptr;
+	}
+	return &Kernel;
+}
+
+bool FWebGPUNoise::EncodeFill(WGPUComputePassEncoder Pass, const FWebGPUImage& Output, uint32 Width, uint32 Height, const FWebGPUNoiseSettings& Settings)
+{
+	if (!IsInitialized() || !Output.IsValid() || Width == 0 || Height == 0)
+	{
+		return false;
+	}
+
+	FWebGPUKernel* Kernel = GetKernel(Output.IsTexture());
+	if (!Kernel)
+	{
+		return false;
+	}
+
+	FNoiseParams Params = {};
+	Params.Width = Width;
+	Params.Height = Height;
+	Params.Seed = Settings.Seed;
+	Params.Octaves = FMath::Clamp(Settings.Octaves, 1, MaxOctaves);
+	Params.Type = (uint32)Settings.Type;
+	Params.Frequency = Settings.Frequency;
+	Params.Lacunarity = Settings.Lacunarity;
+	Params.Gain = Settings.Gain;
+	Params.Warp = Settings.WarpStrength;
+	Params.Origin[0] = Settings.OriginX;
+	Params.Origin[1] = Settings.OriginY;
+	Params.Origin[2] = Settings.OriginZ;
+
+	WGPUBindGroupEntry Entry = {};
+	Entry.binding = 0;
+	if (Output.IsTexture())
+	{
+		Entry.textureView = Output.Texture;
+	}
+	else
+	{
+		Entry.buffer = Output.Buffer;
+		Entry.size = wgpuBufferGetSize(Output.Buffer);
+	}
+
+	WGPUBindGroup BindGroup = Kernel->CreateBindGroup(TArray<WGPUBindGroupEntry>({ Entry }));
+	const bool bDispatched = Kernel->Dispatch(Pass, BindGroup, Params, FMath::DivideAndRoundUp(Width, TileSize), FMath::DivideAndRoundUp(Height, TileSize));
+	wgpuBindGroupRelease(BindGroup);
+	return bDispatched;
+}
+
+bool FWebGPUNoise::Fill(uint32 Width, uint32 Height, const FWebGPUNoiseSettings& Settings, TArray<float>& OutData)
+{
+	if (!IsInitialized())
+	{
+		return false;
+	}
+
+	const uint64 NumPixels = (uint64)Width * Height;
+	Context->EnsureScratchBuffer(Scratch, ScratchCapacity, NumPixels * sizeof(float), WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc, "noise_output_buffer");
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+	const bool bEncoded = EncodeFill(ComputePassEncoder, FWebGPUImage::FromBuffer(Scratch), Width, Height, Settings);
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	Context->Submit(CommandEncoder);
+
+	if (!bEncoded)
+	{
+		return false;
+	}
+
+	OutData.SetNumUninitialized(NumPixels);
+	return Context->ReadBufferSync(Scratch, 0, NumPixels * sizeof(float), OutData.GetData());
+}
+
+float FWebGPUNoise::SampleCPU(const FWebGPUNoiseSettings& Settings, float X, float Y)
+{
+	const int32 Octaves = FMath::Clamp(Settings.Octaves, 1, MaxOctaves);
+
+	float PX = (X + Settings.OriginX) * Settings.Frequency;
+	float PY = (Y + Settings.OriginY) * Settings.Frequency;
+	const float PZ = Settings.OriginZ * Settings.Frequency;
+
+	if (Settings.WarpStrength != 0.f)
+	{
+		const float WX = Fbm(Settings, Octaves, PX, PY, PZ, Settings.Seed ^ 0x68e31da4u);
+		const float WY = Fbm(Settings, Octaves, PX + 5.2f, PY + 1.3f, PZ, Settings.Seed ^ 0xb5297a4du);
+		PX = PX + WX * Settings.WarpStrength;
+		PY = PY + WY * Settings.WarpStrength;
+	}
+
+	return Fbm(Settings, Octaves, PX, PY, PZ, Settings.Seed);
+}
+
+void FWebGPUNoise::FillCPU(uint32 Width, uint32 Height, const FWebGPUNoiseSettings& Settings, TArray<float>& OutData)
+{
+	OutData.SetNumUninitialized((int64)Width * Height);
+
+	ParallelFor(Height, [&](int32 Row)
+	{
+		float* Out = OutData.GetData() + (int64)Row * Width;
+		for (uint32 Col = 0; Col < Width; Col++)
+		{
+			Out[Col] = SampleCPU(Settings, (float)Col, (float)Row);
+		}
+	});
+}
@@ -0,0 +1,421 @@
+#include "WebGPURadixSort.h"
+#include "WebGPUContext.h"
+
+namespace
+{
+	//Placeholders: KEY_T, DIGIT_SOURCE, and in the scatter PAYLOAD_BINDINGS, LOAD_VAL, STORE_VAL
+	const char* SortCommonSource = (R"(
+struct Params {
+	count: u32,
+	shift: u32,
+	word: u32,
+	num_tiles: u32,
+}
+
+const WG: u32 = 256u;
+const ITEMS: u32 = 4u;
+const TILE: u32 = 1024u;
+const DIGITS: u32 = 16u;
+
+@group(1) @binding(0) var<uniform> params: Params;
+
+fn digit_of(k: KEY_T) -> u32 {
+	DIGIT_SOURCE
+}
+
+fn tile_index(wid: vec3<u32>, nwg: vec3<u32>) -> u32 {
+	return wid.y * nwg.x + wid.x;
+}
+		)");
+
+	const char* HistogramSource = (R"(
+@group(0) @binding(0) var<storage, read> keys_in: array<KEY_T>;
+@group(0) @binding(1) var<storage, read_write> histogram: array<u32>;
+
+var<workgroup> counts: array<atomic<u32>, 16>;
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let tile = tile_index(wid, nwg);
+	if (tile >= params.num_tiles) {
+		return;
+	}
+
+	let base = tile * TILE;
+	for (var j = 0u; j < ITEMS; j++) {
+		let k = base + j * WG + lid;
+		if (k < params.count) {
+			atomicAdd(&counts[digit_of(keys_in[k])], 1u);
+		}
+	}
+	workgroupBarrier();
+
+	// digit-major, so one exclusive scan yields every tile's output offset per digit
+	if (lid < DIGITS) {
+		histogram[lid * params.num_tiles + tile] = atomicLoad(&counts[lid]);
+	}
+}
+		)");
+
+	const char* ScatterSource = (R"(
+@group(0) @binding(0) var<storage, read> keys_in: array<KEY_T>;
+@group(0) @binding(1) var<storage, read> digit_offsets: array<u32>;
+@group(0) @binding(2) var<storage, read_write> keys_out: array<KEY_T>;
+PAYLOAD_BINDINGS
+
+var<workgroup> tile_keys: array<KEY_T, 1024>;
+var<workgroup> tile_vals: array<u32, 1024>;
+var<workgroup> thread_sums: array<u32, 256>;
+var<workgroup> digit_counts: array<atomic<u32>, 16>;
+var<workgroup> digit_starts: array<u32, 16>;
+
+fn load_val(k: u32) -> u32 {
+	LOAD_VAL
+}
+
+fn store_val(k: u32, v: u32) {
+	STORE_VAL
+}
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let tile = tile_index(wid, nwg);
+	if (tile >= params.num_tiles) {
+		return;
+	}
+
+	let base = tile * TILE;
+	let valid = min(TILE, params.count - base);
+
+	// padding sorts behind every real key of digit 15 since it starts at the tile end
+	for (var j = 0u; j < ITEMS; j++) {
+		let i = j * WG + lid;
+		var key = KEY_T(0xffffffffu);
+		var val = 0u;
+		if (i < valid) {
+			key = keys_in[base + i];
+			val = load_val(base + i);
+			atomicAdd(&digit_counts[digit_of(key)], 1u);
+		}
+		tile_keys[i] = key;
+		tile_vals[i] = val;
+	}
+	workgroupBarrier();
+
+	// stable local sort by digit: one 1-bit split per digit bit, zeros first
+	for (var b = 0u; b < 4u; b++) {
+		var keys: array<KEY_T, 4>;
+		var vals: array<u32, 4>;
+		var zero_flags: array<u32, 4>;
+		var zeros = 0u;
+		for (var j = 0u; j < ITEMS; j++) {
+			let idx = lid * ITEMS + j;
+			keys[j] = tile_keys[idx];
+			vals[j] = tile_vals[idx];
+			zero_flags[j] = 1u - ((digit_of(keys[j]) >> b) & 1u);
+			zeros += zero_flags[j];
+		}
+		thread_sums[lid] = zeros;
+		workgroupBarrier();
+
+		for (var d = 1u; d < WG; d = d << 1u) {
+			var t = thread_sums[lid];
+			if (lid >= d) {
+				t += thread_sums[lid - d];
+			}
+			workgroupBarrier();
+			thread_sums[lid] = t;
+			workgroupBarrier();
+		}
+
+		let total_zeros = thread_sums[WG - 1u];
+		var zeros_before = thread_sums[lid] - zeros;
+
+		for (var j = 0u; j < ITEMS; j++) {
+			let idx = lid * ITEMS + j;
+			var dst = 0u;
+			if (zero_flags[j] != 0u) {
+				dst = zeros_before;
+				zeros_before++;
+			} else {
+				dst = total_zeros + idx - zeros_before;
+			}
+			tile_keys[dst] = keys[j];
+			tile_vals[dst] = vals[j];
+		}
+		workgroupBarrier();
+	}
+
+	if (lid == 0u) {
+		var start = 0u;
+		for (var d = 0u; d < DIGITS; d++) {
+			digit_starts[d] = start;
+			start += atomicLoad(&digit_counts[d]);
+		}
+	}
+	workgroupBarrier();
+
+	// consecutive lanes write consecutive keys of the same digit run
+	for (var j = 0u; j < ITEMS; j++) {
+		let i = j * WG + lid;
+		if (i < valid) {
+			let key = tile_keys[i];
+			let digit = digit_of(key);
+			let dst = digit_offsets[digit * params.num_tiles + tile] + i - digit_starts[digit];
+			keys_out[dst] = key;
+			store_val(dst, tile_vals[i]);
+		}
+	}
+}
+		)");
+
+	FString BuildSortSource(const char* KernelSource, bool b64BitKeys, bool bPayload)
+	{
+		FString Source = FString(SortCommonSource) + FString(KernelSource);
+
+		Source.ReplaceInline(TEXT("PAYLOAD_BINDINGS"), bPayload ?
+			TEXT("@group(0) @binding(3) var<storage, read> vals_in: array<u32>;\n@group(0) @binding(4) var<storage, read_write> vals_out: array<u32>;") : TEXT(""));
+		Source.ReplaceInline(TEXT("LOAD_VAL"), bPayload ? TEXT("return vals_in[k];") : TEXT("return 0u;"));
+		Source.ReplaceInline(TEXT("STORE_VAL"), bPayload ? TEXT("vals_out[k] = v;") : TEXT(""));
+
+		//64 bit keys are (lo, hi) pairs, params.word picks the half this pass looks at
+		Source.ReplaceInline(TEXT("DIGIT_SOURCE"), b64BitKeys ?
+			TEXT("return (select(k.x, k.y, params.word != 0u) >> params.shift) & 15u;") :
+			TEXT("return (k >> params.shift) & 15u;"));
+		Source.ReplaceInline(TEXT("KEY_T"), b64BitKeys ? TEXT("vec2<u32>") : TEXT("u32"));
+		return Source;
+	}
+
+	template<typename KeyType>
+	void LSDRadixSort(TArray<KeyType>& Keys, TArray<uint32>* Payload)
+	{
+		const int32 Num = Keys.Num();
+		const uint32 NumDigits = FWebGPURadixSort::NumDigits;
+
+		TArray<KeyType> TempKeys;
+		TempKeys.SetNumUninitialized(Num);
+
+		TArray<uint32> TempPayload;
+		if (Payload)
+		{
+			TempPayload.SetNumUninitialized(Num);
+		}
+
+		for (uint32 Shift = 0; Shift < sizeof(KeyType) * 8; Shift += FWebGPURadixSort::RadixBits)
+		{
+			uint32 Offsets[NumDigits] = {};
+			for (const KeyType Key : Keys)
+			{
+				Offsets[(Key >> Shift) & (NumDigits - 1)]++;
+			}
+
+			uint32 Running = 0;
+			for (uint32& Offset : Offsets)
+			{
+				const uint32 Count = Offset;
+				Offset = Running;
+				Running += Count;
+			}
+
+			for (int32 i = 0; i < Num; i++)
+			{
+				const uint32 Dst = Offsets[(Keys[i] >> Shift) & (NumDigits - 1)]++;
+				TempKeys[Dst] = Keys[i];
+				if (Payload)
+				{
+					TempPayload[Dst] = (*Payload)[i];
+				}
+			}
+
+			Swap(Keys, TempKeys);
+			if (Payload)
+			{
+				Swap(*Payload, TempPayload);
+			}
+		}
+	}
+}
+
+FWebGPURadixSort::~FWebGPURadixSort()
+{
+	Release();
+}
+
+bool FWebGPURadixSort::Initialize(FWebGPUContext& InContext)
+{
+	Release();
+
+	Context = &InContext;
+
+	return Scan.Initialize(InContext);
+}
+
+void FWebGPURadixSort::Release()
+{
+	for (FWebGPUKernel& Kernel : HistogramKernels)
+	{
+		Kernel.Release();
+	}
+	for (auto& PayloadKernels : ScatterKernels)
+	{
+		for (FWebGPUKernel& Kernel : PayloadKernels)
+		{
+			Kernel.Release();
+		}
+	}
+
+	for (WGPUBuffer* Buffer : { &TempKeys, &TempPayload, &Histogram, &DigitOffsets })
+	{
+		if (*Buffer)
+		{
+			wgpuBufferRelease(*Buffer);
+			*Buffer = nullptr;
+		}
+	}
+	TempKeysCapacity = 0;
+	TempPayloadCapacity = 0;
+	HistogramCapacity = 0;
+	DigitOffsetsCapacity = 0;
+
+	Scan.Release();
+	Context = nullptr;
+}
+
+bool FWebGPURadixSort::EnsureKernels(bool b64BitKeys, bool bPayload)
+{
+	FWebGPUKernel& HistogramKernel = HistogramKernels[b64BitKeys ? 1 : 0];
+	if (!HistogramKernel.IsValid() && !HistogramKernel.Create(*Context, BuildSortSource(HistogramSource, b64BitKeys, false),
+		{ WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_Storage }, true))
+	{
+		return false;
+	}
+
+	TArray<WGPUBufferBindingType> ScatterBindings = { WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_Storage };
+	if (bPayload)
+	{
+		ScatterBindings.Add(WGPUBufferBindingType_ReadOnlyStorage);
+		ScatterBindings.Add(WGPUBufferBindingType_Storage);
+	}
+
+	FWebGPUKernel& ScatterKernel = ScatterKernels[b64BitKeys ? 1 : 0][bPayload ? 1 : 0];
+	return ScatterKernel.IsValid() || ScatterKernel.Create(*Context, BuildSortSource(ScatterSource, b64BitKeys, bPayload), ScatterBindings, true);
+}
+
+bool FWebGPURadixSort::EncodeSort(WGPUComputePassEncoder Pass, WGPUBuffer Keys, WGPUBuffer Payload, uint32 Count, bool b64BitKeys)
+{
+	if (!IsInitialized())
+	{
+		return false;
+	}
+	if (Count < 2)
+	{
+		return true;
+	}
+
+	const bool bPayload = Payload != nullptr;
+	if (!EnsureKernels(b64BitKeys, bPayload))
+	{
+		return false;
+	}
+
+	const uint32 NumTiles = FMath::DivideAndRoundUp(Count, TileSize);
+	uint32 GroupsX = 0;
+	uint32 GroupsY = 0;
+	Context->GetGroupCounts(NumTiles, GroupsX, GroupsY);
+	const uint32 KeySize = b64BitKeys ? sizeof(uint64) : sizeof(uint32);
+	const WGPUBufferUsage ScratchUsage = WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc | WGPUBufferUsage_CopyDst;
+
+	Context->EnsureScratchBuffer(TempKeys, TempKeysCapacity, (uint64)Count * KeySize, ScratchUsage, "radix_temp_keys_buffer");
+	if (bPayload)
+	{
+		Context->EnsureScratchBuffer(TempPayload, TempPayloadCapacity, (uint64)Count * sizeof(uint32), ScratchUsage, "radix_temp_payload_buffer");
+	}
+	Context->EnsureScratchBuffer(Histogram, HistogramCapacity, (uint64)NumTiles * NumDigits * sizeof(uint32), ScratchUsage, "radix_histogram_buffer");
+	Context->EnsureScratchBuffer(DigitOffsets, DigitOffsetsCapacity, (uint64)NumTiles * NumDigits * sizeof(uint32), ScratchUsage, "radix_digit_offsets_buffer");
+
+	const FWebGPUKernel& HistogramKernel = HistogramKernels[b64BitKeys ? 1 : 0];
+	const FWebGPUKernel& ScatterKernel = ScatterKernels[b64BitKeys ? 1 : 0][bPayload ? 1 : 0];
+
+	WGPUBuffer KeysFrom = Keys;
+	WGPUBuffer KeysTo = TempKeys;
+	WGPUBuffer PayloadFrom = Payload;
+	WGPUBuffer PayloadTo = TempPayload;
+
+	const uint32 NumPasses = KeySize * 8 / RadixBits;
+	for (uint32 PassIndex = 0; PassIndex < NumPasses; PassIndex++)
+	{
+		const uint32 Bit = PassIndex * RadixBits;
+
+		FSortParams Params;
+		Params.Count = Count;
+		Params.Shift = Bit % 32;
+		Params.Word = Bit / 32;
+		Params.NumTiles = NumTiles;
+
+		WGPUBindGroup HistogramBindGroup = HistogramKernel.CreateBindGroup({ KeysFrom, Histogram });
+		const bool bCounted = HistogramKernel.Dispatch(Pass, HistogramBindGroup, Params, GroupsX, GroupsY);
+		wgpuBindGroupRelease(HistogramBindGroup);
+
+		if (!bCounted || !Scan.EncodeScan(Pass, Histogram, DigitOffsets, NumTiles * NumDigits, false, EWebGPUScalarType::UInt32))
+		{
+			return false;
+		}
+
+		TArray<WGPUBuffer> ScatterBuffers = { KeysFrom, DigitOffsets, KeysTo };
+		if (bPayload)
+		{
+			ScatterBuffers.Add(PayloadFrom);
+			ScatterBuffers.Add(PayloadTo);
+		}
+
+		WGPUBindGroup ScatterBindGroup = ScatterKernel.CreateBindGroup(ScatterBuffers);
+		const bool bScattered = ScatterKernel.Dispatch(Pass, ScatterBindGroup, Params, GroupsX, GroupsY);
+		wgpuBindGroupRelease(ScatterBindGroup);
+		if (!bScattered)
+		{
+			return false;
+		}
+
+		Swap(KeysFrom, KeysTo);
+		Swap(PayloadFrom, PayloadTo);
+	}
+
+	//8 or 16 passes, so the last scatter wrote back into Keys/Payload
+	check(KeysFrom == Keys);
+	return true;
+}
+
+bool FWebGPURadixSort::Sort(WGPUBuffer Keys, WGPUBuffer Payload, uint32 Count, bool b64BitKeys)
+{
+	if (!IsInitialized())
+	{
+		return false;
+	}
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+	const bool bEncoded = EncodeSort(ComputePassEncoder, Keys, Payload, Count, b64BitKeys);
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	Context->Submit(CommandEncoder);
+	return bEncoded;
+}
+
+void FWebGPURadixSort::SortOnCPU(TArray<uint32>& Keys, TArray<uint32>* Payload)
+{
+	LSDRadixSort(Keys, Payload);
+}
+
+void FWebGPURadixSort::SortOnCPU(TArray<uint64>& Keys, TArray<uint32>* Payload)
+{
+	LSDRadixSort(Keys, Payload);
+}
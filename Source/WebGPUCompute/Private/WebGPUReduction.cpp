@@ -0,0 +1,314 @@
+#include "WebGPUReduction.h"
+#include "WebGPUContext.h"
+
+namespace
+{
+	//Placeholders: SCALAR_T, SEED_EXPR, COMBINE_BODY, SUBGROUP_BUILTINS, REDUCE_BODY
+	const char* ReduceSourceTemplate = (R"(
+struct Params {
+	count: u32,
+	first_pass: u32,
+	pad0: u32,
+	pad1: u32,
+}
+
+struct Item {
+	v: SCALAR_T,
+	i: u32,
+}
+
+@group(0) @binding(0) var<storage, read> src: array<u32>;
+@group(0) @binding(1) var<storage, read_write> dst: array<u32>;
+@group(1) @binding(0) var<uniform> params: Params;
+
+const WG: u32 = 256u;
+
+var<workgroup> partials: array<Item, 256>;
+var<workgroup> subgroup_slots: atomic<u32>;
+
+// the first pass reads raw elements, later passes read (value bits, index) partials
+fn load(k: u32) -> Item {
+	if (params.first_pass != 0u) {
+		return Item(bitcast<SCALAR_T>(src[k]), k);
+	}
+	return Item(bitcast<SCALAR_T>(src[2u * k]), src[2u * k + 1u]);
+}
+
+fn combine(a: Item, b: Item) -> Item {
+	COMBINE_BODY
+}
+
+fn store(group: u32, r: Item) {
+	dst[2u * group] = bitcast<u32>(r.v);
+	dst[2u * group + 1u] = r.i;
+}
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>SUBGROUP_BUILTINS) {
+	let stride = nwg.x * WG;
+
+	// min/max seed with element 0, repeating an element doesn't change them and no lane is left empty
+	var acc = SEED_EXPR;
+	var k = wid.x * WG + lid;
+	if (k < params.count) {
+		loop {
+			acc = combine(acc, load(k));
+			// stride step without wrapping past count
+			if (params.count - k <= stride) {
+				break;
+			}
+			k += stride;
+		}
+	}
+REDUCE_BODY
+}
+		)");
+
+	const char* TreeReduceBody = (R"(
+	partials[lid] = acc;
+	workgroupBarrier();
+	for (var s = WG / 2u; s > 0u; s = s >> 1u) {
+		if (lid < s) {
+			partials[lid] = combine(partials[lid], partials[lid + s]);
+		}
+		workgroupBarrier();
+	}
+	if (lid == 0u) {
+		store(wid.x, partials[0]);
+	}
+)");
+
+	//Subgroup layout isn't guaranteed contiguous, so each subgroup leader claims a slot
+	const char* SubgroupReduceBody = (R"(
+	let r = Item(SUBGROUP_OP(acc.v), 0u);
+	if (sg_lane == 0u) {
+		partials[atomicAdd(&subgroup_slots, 1u)] = r;
+	}
+	workgroupBarrier();
+	if (lid == 0u) {
+		var t = partials[0];
+		let n = atomicLoad(&subgroup_slots);
+		for (var s = 1u; s < n; s++) {
+			t = combine(t, partials[s]);
+		}
+		store(wid.x, t);
+	}
+)");
+
+	const TCHAR* ScalarTypeName(EWebGPUScalarType Type)
+	{
+		switch (Type)
+		{
+		case EWebGPUScalarType::Int32:
+			return TEXT("i32");
+		case EWebGPUScalarType::UInt32:
+			return TEXT("u32");
+		default:
+			return TEXT("f32");
+		}
+	}
+
+	FString BuildReduceSource(EWebGPUReduceOp Op, EWebGPUScalarType Type, bool bSubgroups)
+	{
+		FString Seed = TEXT("load(0u)");
+		FString Combine;
+		FString SubgroupOp;
+
+		switch (Op)
+		{
+		case EWebGPUReduceOp::Sum:
+			Seed = TEXT("Item(SCALAR_T(0), 0u)");
+			Combine = TEXT("return Item(a.v + b.v, 0u);");
+			SubgroupOp = TEXT("subgroupAdd");
+			break;
+		case EWebGPUReduceOp::Min:
+			Combine = TEXT("return Item(min(a.v, b.v), 0u);");
+			SubgroupOp = TEXT("subgroupMin");
+			break;
+		case EWebGPUReduceOp::Max:
+			Combine = TEXT("return Item(max(a.v, b.v), 0u);");
+			SubgroupOp = TEXT("subgroupMax");
+			break;
+		case EWebGPUReduceOp::ArgMax:
+			//Ties go to the lowest index so the result doesn't depend on workgroup order
+			Combine = TEXT("if (b.v > a.v || (b.v == a.v && b.i < a.i)) {\n\t\treturn b;\n\t}\n\treturn a;");
+			break;
+		}
+
+		FString Source(ReduceSourceTemplate);
+		Source.ReplaceInline(TEXT("REDUCE_BODY"), bSubgroups ? UTF8_TO_TCHAR(SubgroupReduceBody) : UTF8_TO_TCHAR(TreeReduceBody));
+		Source.ReplaceInline(TEXT("SUBGROUP_BUILTINS"), bSubgroups ? TEXT(",\n\t@builtin(subgroup_invocation_id) sg_lane: u32") : TEXT(""));
+		Source.ReplaceInline(TEXT("SUBGROUP_OP"), *SubgroupOp);
+		Source.ReplaceInline(TEXT("SEED_EXPR"), *Seed);
+		Source.ReplaceInline(TEXT("COMBINE_BODY"), *Combine);
+		Source.ReplaceInline(TEXT("SCALAR_T"), ScalarTypeName(Type));
+		return Source;
+	}
+
+	uint32 NumReduceGroups(uint32 Count)
+	{
+		return FMath::Clamp(FMath::DivideAndRoundUp(Count, FWebGPUReduction::MaxPartials), 1u, FWebGPUReduction::MaxPartials);
+	}
+}
+
+FWebGPUReduction::~FWebGPUReduction()
+{
+	Release();
+}
+
+bool FWebGPUReduction::Initialize(FWebGPUContext& InContext)
+{
+	Release();
+
+	Context = &InContext;
+	bUseSubgroups = Context->HasNativeFeature(WGPUNativeFeature_Subgroup);
+
+	for (WGPUBuffer& Scratch : ScratchBuffers)
+	{
+		Scratch = Context->CreateBuffer((uint64)MaxPartials * 2 * sizeof(uint32), WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc, "reduce_scratch_buffer");
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Reductions using %s path"), bUseSubgroups ? TEXT("subgroup") : TEXT("shared memory"));
+	return true;
+}
+
+void FWebGPUReduction::Release()
+{
+	for (auto& OpKernels : Kernels)
+	{
+		for (auto& TypeKernels : OpKernels)
+		{
+			for (FWebGPUKernel& Kernel : TypeKernels)
+			{
+				Kernel.Release();
+			}
+		}
+	}
+
+	for (WGPUBuffer& Scratch : ScratchBuffers)
+	{
+		if (Scratch)
+		{
+			wgpuBufferRelease(Scratch);
+			Scratch = nullptr;
+		}
+	}
+
+	ResultBuffer = nullptr;
+	Context = nullptr;
+}
+
+FWebGPUKernel* FWebGPUReduction::GetKernel(EWebGPUReduceOp Op, EWebGPUScalarType Type)
+{
+	//Subgroups have no argmax primitive, that one always takes the tree path
+	const bool bSubgroups = bUseSubgroups && Op != EWebGPUReduceOp::ArgMax;
+
+	FWebGPUKernel& Kernel = Kernels[(int32)Op][(int32)Type][bSubgroups ? 1 : 0];
+	if (Kernel.IsValid())
+	{
+		return &Kernel;
+	}
+
+	const TArray<WGPUBufferBindingType> Bindings = { WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_Storage };
+	if (Kernel.Create(*Context, BuildReduceSource(Op, Type, bSubgroups), Bindings, true))
+	{
+		return &Kernel;
+	}
+
+	if (bSubgroups)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Subgroup reduction failed to compile, falling back to shared memory"));
+		bUseSubgroups = false;
+		return GetKernel(Op, Type);
+	}
+	return nullptr;
+}
+
+bool FWebGPUReduction::EncodeReduce(WGPUComputePassEncoder Pass, WGPUBuffer Input, uint32 Count, EWebGPUReduceOp Op, EWebGPUScalarType Type)
+{
+	if (!IsInitialized() || Count == 0)
+	{
+		return false;
+	}
+
+	FWebGPUKernel* Kernel = GetKernel(Op, Type);
+	if (!Kernel)
+	{
+		return false;
+	}
+
+	FReduceParams Params;
+	Params.Count = Count;
+	Params.FirstPass = 1;
+	Params.Pad0 = 0;
+	Params.Pad1 = 0;
+
+	//Pass i writes ScratchBuffers[i % 2] and the next one reads it back as partials
+	WGPUBuffer Source = Input;
+	for (int32 PassIndex = 0; ; PassIndex++)
+	{
+		const uint32 Groups = NumReduceGroups(Params.Count);
+		WGPUBuffer Destination = ScratchBuffers[PassIndex % 2];
+
+		WGPUBindGroup BindGroup = Kernel->CreateBindGroup({ Source, Destination });
+		const bool bDispatched = Kernel->Dispatch(Pass, BindGroup, Params, Groups);
+		wgpuBindGroupRelease(BindGroup);
+		if (!bDispatched)
+		{
+			return false;
+		}
+
+		Source = Destination;
+		Params.Count = Groups;
+		Params.FirstPass = 0;
+
+		if (Groups == 1)
+		{
+			break;
+		}
+	}
+
+	ResultBuffer = Source;
+	return true;
+}
+
+bool FWebGPUReduction::Reduce(WGPUBuffer Input, uint32 Count, EWebGPUReduceOp Op, EWebGPUScalarType Type, void* OutValue, uint32* OutIndex)
+{
+	if (!IsInitialized() || Count == 0)
+	{
+		return false;
+	}
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+	const bool bEncoded = EncodeReduce(ComputePassEncoder, Input, Count, Op, Type);
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	Context->Submit(CommandEncoder);
+
+	if (!bEncoded)
+	{
+		return false;
+	}
+
+	//Value bits, then the index only when someone asked for it
+	uint32 Result[2] = { 0, 0 };
+	const uint64 ReadSize = OutIndex ? sizeof(Result) : sizeof(uint32);
+	if (!Context->ReadBufferSync(ResultBuffer, 0, ReadSize, Result))
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(OutValue, &Result[0], sizeof(uint32));
+	if (OutIndex)
+	{
+		*OutIndex = Result[1];
+	}
+	return true;
+}
@@ -0,0 +1,314 @@
+#include "WebGPUScan.h"
+#include "WebGPUContext.h"
+
+namespace
+{
+	//SCALAR_T is substituted per type, both kernels share the common block
+	const char* ScanCommonSource = (R"(
+struct Params {
+	count: u32,
+	inclusive: u32,
+	has_offsets: u32,
+	pad: u32,
+}
+
+const WG: u32 = 256u;
+const ITEMS: u32 = 4u;
+const TILE: u32 = 1024u;
+
+@group(1) @binding(0) var<uniform> params: Params;
+
+var<workgroup> tile_data: array<SCALAR_T, 1024>;
+var<workgroup> thread_sums: array<SCALAR_T, 256>;
+
+fn num_tiles() -> u32 {
+	return params.count / TILE + select(0u, 1u, params.count % TILE != 0u);
+}
+		)");
+
+	const char* ReduceTilesSource = (R"(
+@group(0) @binding(0) var<storage, read> src: array<SCALAR_T>;
+@group(0) @binding(1) var<storage, read_write> tile_sums: array<SCALAR_T>;
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let tile = wid.y * nwg.x + wid.x;
+	if (tile >= num_tiles()) {
+		return;
+	}
+
+	// coalesced: consecutive lanes read consecutive elements
+	let base = tile * TILE;
+	var acc = SCALAR_T(0);
+	for (var j = 0u; j < ITEMS; j++) {
+		let k = base + j * WG + lid;
+		if (k < params.count) {
+			acc += src[k];
+		}
+	}
+
+	thread_sums[lid] = acc;
+	workgroupBarrier();
+	for (var s = WG / 2u; s > 0u; s = s >> 1u) {
+		if (lid < s) {
+			thread_sums[lid] += thread_sums[lid + s];
+		}
+		workgroupBarrier();
+	}
+	if (lid == 0u) {
+		tile_sums[tile] = thread_sums[0];
+	}
+}
+		)");
+
+	const char* ScanTilesSource = (R"(
+@group(0) @binding(0) var<storage, read> src: array<SCALAR_T>;
+@group(0) @binding(1) var<storage, read> tile_offsets: array<SCALAR_T>;
+@group(0) @binding(2) var<storage, read_write> dst: array<SCALAR_T>;
+
+@compute
+@workgroup_size(256)
+fn main(@builtin(local_invocation_index) lid: u32,
+	@builtin(workgroup_id) wid: vec3<u32>,
+	@builtin(num_workgroups) nwg: vec3<u32>) {
+	let tile = wid.y * nwg.x + wid.x;
+	if (tile >= num_tiles()) {
+		return;
+	}
+
+	let base = tile * TILE;
+	for (var j = 0u; j < ITEMS; j++) {
+		let k = base + j * WG + lid;
+		var v = SCALAR_T(0);
+		if (k < params.count) {
+			v = src[k];
+		}
+		tile_data[j * WG + lid] = v;
+	}
+	workgroupBarrier();
+
+	// serial inclusive scan of this thread's run of ITEMS
+	var run = SCALAR_T(0);
+	for (var j = 0u; j < ITEMS; j++) {
+		let idx = lid * ITEMS + j;
+		run += tile_data[idx];
+		tile_data[idx] = run;
+	}
+	thread_sums[lid] = run;
+	workgroupBarrier();
+
+	// Hillis-Steele over the per-thread totals
+	for (var d = 1u; d < WG; d = d << 1u) {
+		var t = thread_sums[lid];
+		if (lid >= d) {
+			t += thread_sums[lid - d];
+		}
+		workgroupBarrier();
+		thread_sums[lid] = t;
+		workgroupBarrier();
+	}
+
+	var prefix = SCALAR_T(0);
+	if (lid > 0u) {
+		prefix = thread_sums[lid - 1u];
+	}
+	if (params.has_offsets != 0u) {
+		prefix += tile_offsets[tile];
+	}
+
+	// back to front so the exclusive value can still read its left neighbour's local sum
+	for (var j = ITEMS; j > 0u; j--) {
+		let idx = lid * ITEMS + j - 1u;
+		var local_sum = tile_data[idx];
+		if (params.inclusive == 0u) {
+			local_sum = SCALAR_T(0);
+			if (j > 1u) {
+				local_sum = tile_data[idx - 1u];
+			}
+		}
+		tile_data[idx] = prefix + local_sum;
+	}
+	workgroupBarrier();
+
+	for (var j = 0u; j < ITEMS; j++) {
+		let k = base + j * WG + lid;
+		if (k < params.count) {
+			dst[k] = tile_data[j * WG + lid];
+		}
+	}
+}
+		)");
+
+	FString BuildScanSource(EWebGPUScalarType Type, bool bReduce)
+	{
+		FString Source = FString(ScanCommonSource) + FString(bReduce ? ReduceTilesSource : ScanTilesSource);
+		Source.ReplaceInline(TEXT("SCALAR_T"), Type == EWebGPUScalarType::Float ? TEXT("f32") : Type == EWebGPUScalarType::Int32 ? TEXT("i32") : TEXT("u32"));
+		return Source;
+	}
+}
+
+FWebGPUScan::~FWebGPUScan()
+{
+	Release();
+}
+
+bool FWebGPUScan::Initialize(FWebGPUContext& InContext)
+{
+	Release();
+
+	Context = &InContext;
+
+	DummyOffsets = Context->CreateBuffer(sizeof(uint32), WGPUBufferUsage_Storage, "scan_dummy_offsets_buffer");
+	return true;
+}
+
+void FWebGPUScan::Release()
+{
+	for (FScanKernels& TypeKernels : Kernels)
+	{
+		TypeKernels.Reduce.Release();
+		TypeKernels.ScanTiles.Release();
+	}
+
+	for (FScanLevel& Level : Levels)
+	{
+		wgpuBufferRelease(Level.TileSums);
+		wgpuBufferRelease(Level.TileOffsets);
+	}
+	Levels.Empty();
+
+	if (DummyOffsets)
+	{
+		wgpuBufferRelease(DummyOffsets);
+		DummyOffsets = nullptr;
+	}
+
+	Context = nullptr;
+}
+
+FWebGPUScan::FScanKernels* FWebGPUScan::GetKernels(EWebGPUScalarType Type)
+{
+	FScanKernels& TypeKernels = Kernels[(int32)Type];
+	if (TypeKernels.ScanTiles.IsValid())
+	{
+		return &TypeKernels;
+	}
+
+	const bool bCreated =
+		TypeKernels.Reduce.Create(*Context, BuildScanSource(Type, true),
+			{ WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_Storage }, true) &&
+		TypeKernels.ScanTiles.Create(*Context, BuildScanSource(Type, false),
+			{ WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_ReadOnlyStorage, WGPUBufferBindingType_Storage }, true);
+
+	if (!bCreated)
+	{
+		TypeKernels.Reduce.Release();
+		TypeKernels.ScanTiles.Release();
+		return nullptr;
+	}
+	return &TypeKernels;
+}
+
+FWebGPUScan::FScanLevel& FWebGPUScan::GetLevel(int32 Level, uint32 NumTiles)
+{
+	if (Levels.Num() <= Level)
+	{
+		Levels.SetNum(Level + 1);
+	}
+
+	//Grow only, the same sizes come back every frame
+	FScanLevel& ScanLevel = Levels[Level];
+	if (ScanLevel.Capacity < NumTiles)
+	{
+		if (ScanLevel.TileSums)
+		{
+			wgpuBufferRelease(ScanLevel.TileSums);
+			wgpuBufferRelease(ScanLevel.TileOffsets);
+		}
+
+		const uint64 Size = (uint64)NumTiles * sizeof(uint32);
+		ScanLevel.TileSums = Context->CreateBuffer(Size, WGPUBufferUsage_Storage, "scan_tile_sums_buffer");
+		ScanLevel.TileOffsets = Context->CreateBuffer(Size, WGPUBufferUsage_Storage | WGPUBufferUsage_CopySrc, "scan_tile_offsets_buffer");
+		ScanLevel.Capacity = NumTiles;
+	}
+	return ScanLevel;
+}
+
+bool FWebGPUScan::EncodeLevel(WGPUComputePassEncoder Pass, FScanKernels& TypeKernels, WGPUBuffer Input, WGPUBuffer Output, uint32 Count, bool bInclusive, int32 Level)
+{
+	const uint32 NumTiles = FMath::DivideAndRoundUp(Count, TileSize);
+
+	uint32 GroupsX = 0;
+	uint32 GroupsY = 0;
+	Context->GetGroupCounts(NumTiles, GroupsX, GroupsY);
+
+	FScanParams Params;
+	Params.Count = Count;
+	Params.Inclusive = bInclusive ? 1 : 0;
+	Params.HasOffsets = 0;
+	Params.Pad = 0;
+
+	WGPUBuffer Offsets = DummyOffsets;
+
+	if (NumTiles > 1)
+	{
+		//Copy the handles out, the recursion may grow Levels
+		const FScanLevel& ScanLevel = GetLevel(Level, NumTiles);
+		WGPUBuffer TileSums = ScanLevel.TileSums;
+		Offsets = ScanLevel.TileOffsets;
+
+		WGPUBindGroup ReduceBindGroup = TypeKernels.Reduce.CreateBindGroup({ Input, TileSums });
+		const bool bReduced = TypeKernels.Reduce.Dispatch(Pass, ReduceBindGroup, Params, GroupsX, GroupsY);
+		wgpuBindGroupRelease(ReduceBindGroup);
+
+		if (!bReduced || !EncodeLevel(Pass, TypeKernels, TileSums, Offsets, NumTiles, false, Level + 1))
+		{
+			return false;
+		}
+
+		Params.HasOffsets = 1;
+	}
+
+	WGPUBindGroup ScanBindGroup = TypeKernels.ScanTiles.CreateBindGroup({ Input, Offsets, Output });
+	const bool bScanned = TypeKernels.ScanTiles.Dispatch(Pass, ScanBindGroup, Params, GroupsX, GroupsY);
+	wgpuBindGroupRelease(ScanBindGroup);
+	return bScanned;
+}
+
+bool FWebGPUScan::EncodeScan(WGPUComputePassEncoder Pass, WGPUBuffer Input, WGPUBuffer Output, uint32 Count, bool bInclusive, EWebGPUScalarType Type)
+{
+	if (!IsInitialized() || Count == 0 || Input == Output)
+	{
+		return false;
+	}
+
+	FScanKernels* TypeKernels = GetKernels(Type);
+	if (!TypeKernels)
+	{
+		return false;
+	}
+
+	return EncodeLevel(Pass, *TypeKernels, Input, Output, Count, bInclusive, 0);
+}
+
+bool FWebGPUScan::Scan(WGPUBuffer Input, WGPUBuffer Output, uint32 Count, bool bInclusive, EWebGPUScalarType Type)
+{
+	if (!IsInitialized())
+	{
+		return false;
+	}
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+
+	const bool bEncoded = EncodeScan(ComputePassEncoder, Input, Output, Count, bInclusive, Type);
+
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	Context->Submit(CommandEncoder);
+	return bEncoded;
+}
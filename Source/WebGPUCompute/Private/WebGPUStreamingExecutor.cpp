@@ -0,0 +1,253 @@
+#include "WebGPUStreamingExecutor.h"
+#include "WebGPUContext.h"
+
+namespace
+{
+	void OnStreamBufferMapped(WGPUMapAsyncStatus Status, WGPUStringView Message, void* UserData1, void* UserData2)
+	{
+		*reinterpret_cast<bool*>(UserData1) = Status == WGPUMapAsyncStatus_Success;
+		if (Status != WGPUMapAsyncStatus_Success)
+		{
+			*reinterpret_cast<bool*>(UserData2) = true;
+			UE_LOG(LogTemp, Warning, TEXT("Streaming buffer map failed, status=%#.8x"), Status);
+		}
+	}
+
+	void MapStreamBuffer(WGPUBuffer Buffer, WGPUMapMode Mode, uint64 Size, bool* bMapped, bool* bFailed)
+	{
+		*bMapped = false;
+
+		WGPUBufferMapCallbackInfo MapInfo = {};
+		MapInfo.mode = WGPUCallbackMode_AllowProcessEvents;
+		MapInfo.callback = OnStreamBufferMapped;
+		MapInfo.userdata1 = bMapped;
+		MapInfo.userdata2 = bFailed;
+
+		wgpuBufferMapAsync(Buffer, Mode, 0, Size, MapInfo);
+	}
+}
+
+FWebGPUStreamingExecutor::~FWebGPUStreamingExecutor()
+{
+	Release();
+}
+
+bool FWebGPUStreamingExecutor::Initialize(FWebGPUContext& InContext, const FString& Source, uint32 InWorkgroupSize, uint64 MaxChunkBytes)
+{
+	Release();
+
+	Context = &InContext;
+	WorkgroupSize = FMath::Max(InWorkgroupSize, 1u);
+
+	if (!Kernel.Create(*Context, Source, { WGPUBufferBindingType_Storage }, true))
+	{
+		return false;
+	}
+
+	const WGPULimits& Limits = Context->GetLimits();
+
+	//A chunk has to fit one buffer and one storage binding, and its element count has to fit a u32
+	ChunkBytes = MaxChunkBytes > 0 ? MaxChunkBytes : DefaultChunkBytes;
+	ChunkBytes = FMath::Min<uint64>(ChunkBytes, Limits.maxBufferSize);
+	ChunkBytes = FMath::Min<uint64>(ChunkBytes, Limits.maxStorageBufferBindingSize);
+	ChunkBytes = FMath::Min<uint64>(ChunkBytes, (uint64)MAX_uint32 * sizeof(uint32));
+	ChunkBytes = AlignDown(ChunkBytes, (uint64)256);
+
+	if (ChunkBytes == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Streaming executor could not size chunks from device limits"));
+		Release();
+		return false;
+	}
+
+	for (FStreamSlot& Slot : Slots)
+	{
+		//Upload staging starts out mapped so the first chunk can be written straight into it
+		WGPUBufferDescriptor UploadDesc = {};
+		UploadDesc.label = { "stream_upload_buffer", WGPU_STRLEN };
+		UploadDesc.usage = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
+		UploadDesc.size = ChunkBytes;
+		UploadDesc.mappedAtCreation = true;
+
+		Slot.UploadBuffer = wgpuDeviceCreateBuffer(Context->Device, &UploadDesc);
+		Slot.StorageBuffer = Context->CreateBuffer(ChunkBytes, WGPUBufferUsage_Storage | WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc, "stream_storage_buffer");
+		Slot.ReadbackBuffer = Context->CreateBuffer(ChunkBytes, WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst, "stream_readback_buffer");
+		Slot.BindGroup = Kernel.CreateBindGroup({ Slot.StorageBuffer });
+		Slot.bUploadMapped = true;
+		Slot.bReadbackMapped = false;
+		Slot.bPending = false;
+		Slot.bMapFailed = false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Streaming executor chunk size: %llu bytes"), ChunkBytes);
+	return true;
+}
+
+void FWebGPUStreamingExecutor::Release()
+{
+	for (FStreamSlot& Slot : Slots)
+	{
+		if (Slot.bPending && Context)
+		{
+			wgpuDevicePoll(Context->Device, true, &Slot.SubmissionIndex);
+		}
+		if (Slot.BindGroup)
+		{
+			wgpuBindGroupRelease(Slot.BindGroup);
+		}
+		if (Slot.ReadbackBuffer)
+		{
+			wgpuBufferRelease(Slot.ReadbackBuffer);
+		}
+		if (Slot.StorageBuffer)
+		{
+			wgpuBufferRelease(Slot.StorageBuffer);
+		}
+		if (Slot.UploadBuffer)
+		{
+			wgpuBufferRelease(Slot.UploadBuffer);
+		}
+		Slot = FStreamSlot();
+	}
+
+	Kernel.Release();
+	ChunkBytes = 0;
+	Context = nullptr;
+}
+
+bool FWebGPUStreamingExecutor::SubmitSlot(FStreamSlot& Slot, uint64 Offset, uint64 Size, uint32 ElementSize, FReadChunk& Read)
+{
+	//Input goes directly into the mapped upload staging, no intermediate cpu copy
+	void* UploadData = wgpuBufferGetMappedRange(Slot.UploadBuffer, 0, Size);
+	Read(Offset, UploadData, Size);
+	wgpuBufferUnmap(Slot.UploadBuffer);
+	Slot.bUploadMapped = false;
+
+	const uint64 FirstElement = Offset / sizeof(uint32);
+
+	FChunkParams Params;
+	Params.Count = static_cast<uint32>(Size / sizeof(uint32));
+	Params.FirstLo = static_cast<uint32>(FirstElement & MAX_uint32);
+	Params.FirstHi = static_cast<uint32>(FirstElement >> 32);
+	Params.Pad = 0;
+
+	const uint32 Groups = FMath::DivideAndRoundUp(Params.Count, WorkgroupSize);
+	uint32 GroupsX = 0;
+	uint32 GroupsY = 0;
+	Context->GetGroupCounts(Groups, GroupsX, GroupsY);
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context->Device, nullptr);
+	wgpuCommandEncoderCopyBufferToBuffer(CommandEncoder, Slot.UploadBuffer, 0, Slot.StorageBuffer, 0, Size);
+
+	WGPUComputePassEncoder ComputePassEncoder = wgpuCommandEncoderBeginComputePass(CommandEncoder, nullptr);
+	//Still submitted without the kernel so the slot's buffers go through their usual map cycle
+	Slot.bDispatchFailed = !Kernel.Dispatch(ComputePassEncoder, Slot.BindGroup, Params, GroupsX, GroupsY);
+	wgpuComputePassEncoderEnd(ComputePassEncoder);
+	wgpuComputePassEncoderRelease(ComputePassEncoder);
+
+	wgpuCommandEncoderCopyBufferToBuffer(CommandEncoder, Slot.StorageBuffer, 0, Slot.ReadbackBuffer, 0, Size);
+
+	Context->GetUniformRing().Flush();
+
+	WGPUCommandBuffer CommandBuffer = wgpuCommandEncoderFinish(CommandEncoder, nullptr);
+	Slot.SubmissionIndex = wgpuQueueSubmitForIndex(Context->Queue, 1, &CommandBuffer);
+	Context->GetUniformRing().MarkSubmitted();
+	wgpuCommandBufferRelease(CommandBuffer);
+	wgpuCommandEncoderRelease(CommandEncoder);
+
+	Slot.Offset = Offset;
+	Slot.Size = Size;
+	Slot.bPending = true;
+
+	//Both resolve once this submission retires: results to read, upload staging to refill
+	MapStreamBuffer(Slot.ReadbackBuffer, WGPUMapMode_Read, Size, &Slot.bReadbackMapped, &Slot.bMapFailed);
+	MapStreamBuffer(Slot.UploadBuffer, WGPUMapMode_Write, ChunkBytes, &Slot.bUploadMapped, &Slot.bMapFailed);
+	return !Slot.bDispatchFailed;
+}
+
+bool FWebGPUStreamingExecutor::RetireSlot(FStreamSlot& Slot, FWriteChunk& Write)
+{
+	if (!Slot.bPending)
+	{
+		return !Slot.bMapFailed;
+	}
+
+	wgpuDevicePoll(Context->Device, true, &Slot.SubmissionIndex);
+	while (!Slot.bMapFailed && (!Slot.bReadbackMapped || !Slot.bUploadMapped))
+	{
+		wgpuDevicePoll(Context->Device, true, nullptr);
+	}
+
+	if (Slot.bMapFailed)
+	{
+		Slot.bPending = false;
+		return false;
+	}
+
+	//Chunk never ran, its readback is just the input copied through
+	const bool bRan = !Slot.bDispatchFailed;
+	if (bRan)
+	{
+		const void* Result = wgpuBufferGetConstMappedRange(Slot.ReadbackBuffer, 0, Slot.Size);
+		Write(Slot.Offset, Result, Slot.Size);
+	}
+	wgpuBufferUnmap(Slot.ReadbackBuffer);
+
+	Slot.bReadbackMapped = false;
+	Slot.bDispatchFailed = false;
+	Slot.bPending = false;
+	return bRan;
+}
+
+bool FWebGPUStreamingExecutor::Run(uint64 TotalBytes, uint32 ElementSize, FReadChunk Read, FWriteChunk Write)
+{
+	if (!IsInitialized())
+	{
+		return false;
+	}
+	if (ElementSize == 0 || ElementSize % sizeof(uint32) != 0 || TotalBytes % ElementSize != 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Streaming input of %llu bytes is not a whole number of %u byte elements"), TotalBytes, ElementSize);
+		return false;
+	}
+
+	if (TotalBytes == 0)
+	{
+		return true;
+	}
+
+	//Keep chunk boundaries on whole elements
+	const uint64 StepBytes = ChunkBytes - (ChunkBytes % ElementSize);
+	if (StepBytes == 0)
+	{
+		return false;
+	}
+
+	const uint64 NumChunks = (TotalBytes + StepBytes - 1) / StepBytes;
+	bool bSuccess = true;
+
+	for (uint64 ChunkIndex = 0; ChunkIndex < NumChunks && bSuccess; ChunkIndex++)
+	{
+		FStreamSlot& Slot = Slots[ChunkIndex % 2];
+
+		//Chunk i-2 finishes here while chunk i-1 is still computing in the other slot
+		bSuccess = RetireSlot(Slot, Write);
+		if (!bSuccess)
+		{
+			break;
+		}
+
+		const uint64 Offset = ChunkIndex * StepBytes;
+		const uint64 Size = FMath::Min(StepBytes, TotalBytes - Offset);
+		bSuccess = SubmitSlot(Slot, Offset, Size, ElementSize, Read);
+	}
+
+	//Drain in submission order so Write sees ascending offsets
+	if (NumChunks > 1)
+	{
+		bSuccess &= RetireSlot(Slots[(NumChunks - 2) % 2], Write);
+	}
+	bSuccess &= RetireSlot(Slots[(NumChunks - 1) % 2], Write);
+
+	return bSuccess;
+}
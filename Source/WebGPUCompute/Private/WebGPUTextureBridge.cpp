@@ -0,0 +1,374 @@
+#include "WebGPUTextureBridge.h"
+#include "WebGPUContext.h"
+#include "Engine/Texture2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#include "RHICommandList.h"
+#include "RHIGPUReadback.h"
+
+void FWebGPUTexture::Release()
+{
+	if (View)
+	{
+		wgpuTextureViewRelease(View);
+		View = nullptr;
+	}
+	if (Texture)
+	{
+		wgpuTextureRelease(Texture);
+		Texture = nullptr;
+	}
+	Width = 0;
+	Height = 0;
+	Format = WGPUTextureFormat_Undefined;
+}
+
+FWebGPUTextureBridge::FWebGPUTextureBridge(FWebGPUContext& InContext)
+	: Context(InContext)
+{
+}
+
+WGPUTextureFormat FWebGPUTextureBridge::ToWGPUFormat(EPixelFormat Format)
+{
+	switch (Format)
+	{
+	case PF_B8G8R8A8:			return WGPUTextureFormat_BGRA8Unorm;
+	case PF_R8G8B8A8:			return WGPUTextureFormat_RGBA8Unorm;
+	case PF_G8:					return WGPUTextureFormat_R8Unorm;
+	case PF_R16F:				return WGPUTextureFormat_R16Float;
+	case PF_G16R16F:			return WGPUTextureFormat_RG16Float;
+	case PF_FloatRGBA:			return WGPUTextureFormat_RGBA16Float;
+	case PF_R32_FLOAT:			return WGPUTextureFormat_R32Float;
+	case PF_G32R32F:			return WGPUTextureFormat_RG32Float;
+	case PF_A32B32G32R32F:		return WGPUTextureFormat_RGBA32Float;
+	case PF_R32_UINT:			return WGPUTextureFormat_R32Uint;
+	case PF_A2B10G10R10:		return WGPUTextureFormat_RGB10A2Unorm;
+	default:					return WGPUTextureFormat_Undefined;
+	}
+}
+
+EPixelFormat FWebGPUTextureBridge::ToPixelFormat(WGPUTextureFormat Format)
+{
+	switch (Format)
+	{
+	case WGPUTextureFormat_BGRA8Unorm:		return PF_B8G8R8A8;
+	case WGPUTextureFormat_RGBA8Unorm:		return PF_R8G8B8A8;
+	case WGPUTextureFormat_R8Unorm:			return PF_G8;
+	case WGPUTextureFormat_R16Float:		return PF_R16F;
+	case WGPUTextureFormat_RG16Float:		return PF_G16R16F;
+	case WGPUTextureFormat_RGBA16Float:		return PF_FloatRGBA;
+	case WGPUTextureFormat_R32Float:		return PF_R32_FLOAT;
+	case WGPUTextureFormat_RG32Float:		return PF_G32R32F;
+	case WGPUTextureFormat_RGBA32Float:		return PF_A32B32G32R32F;
+	case WGPUTextureFormat_R32Uint:			return PF_R32_UINT;
+	case WGPUTextureFormat_RGB10A2Unorm:	return PF_A2B10G10R10;
+	default:								return PF_Unknown;
+	}
+}
+
+uint32 FWebGPUTextureBridge::GetBytesPerPixel(WGPUTextureFormat Format)
+{
+	switch (Format)
+	{
+	case WGPUTextureFormat_R8Unorm:
+		return 1;
+	case WGPUTextureFormat_R16Float:
+		return 2;
+	case WGPUTextureFormat_BGRA8Unorm:
+	case WGPUTextureFormat_RGBA8Unorm:
+	case WGPUTextureFormat_RG16Float:
+	case WGPUTextureFormat_R32Float:
+	case WGPUTextureFormat_R32Uint:
+	case WGPUTextureFormat_RGB10A2Unorm:
+		return 4;
+	case WGPUTextureFormat_RGBA16Float:
+	case WGPUTextureFormat_RG32Float:
+		return 8;
+	case WGPUTextureFormat_RGBA32Float:
+		return 16;
+	default:
+		return 0;
+	}
+}
+
+WGPUTextureSampleType FWebGPUTextureBridge::GetSampleType(WGPUTextureFormat Format)
+{
+	switch (Format)
+	{
+	case WGPUTextureFormat_R32Uint:
+		return WGPUTextureSampleType_Uint;
+	//32 bit floats aren't filterable without float32-filterable
+	case WGPUTextureFormat_R32Float:
+	case WGPUTextureFormat_RG32Float:
+	case WGPUTextureFormat_RGBA32Float:
+		return WGPUTextureSampleType_UnfilterableFloat;
+	default:
+		return WGPUTextureSampleType_Float;
+	}
+}
+
+uint32 FWebGPUTextureBridge::GetAlignedRowPitch(uint32 Width, WGPUTextureFormat Format)
+{
+	return Align(Width * GetBytesPerPixel(Format), RowPitchAlignment);
+}
+
+bool FWebGPUTextureBridge::SupportsStorage(WGPUTextureFormat Format) const
+{
+	switch (Format)
+	{
+	case WGPUTextureFormat_RGBA8Unorm:
+	case WGPUTextureFormat_RGBA16Float:
+	case WGPUTextureFormat_R32Float:
+	case WGPUTextureFormat_RG32Float:
+	case WGPUTextureFormat_RGBA32Float:
+	case WGPUTextureFormat_R32Uint:
+		return true;
+	case WGPUTextureFormat_BGRA8Unorm:
+		return Context.HasFeature(WGPUFeatureName_BGRA8UnormStorage);
+	default:
+		return false;
+	}
+}
+
+bool FWebGPUTextureBridge::CreateTexture(uint32 Width, uint32 Height, WGPUTextureFormat Format, FWebGPUTexture& OutTexture, const char* Label) const
+{
+	OutTexture.Release();
+
+	if (Width == 0 || Height == 0 || GetBytesPerPixel(Format) == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Unsupported bridge texture %ux%u format %#x"), Width, Height, (uint32)Format);
+		return false;
+	}
+
+	WGPUTextureDescriptor TextureDesc = {};
+	TextureDesc.label = { Label, WGPU_STRLEN };
+	TextureDesc.usage = WGPUTextureUsage_TextureBinding | WGPUTextureUsage_CopySrc | WGPUTextureUsage_CopyDst;
+	if (SupportsStorage(Format))
+	{
+		TextureDesc.usage |= WGPUTextureUsage_StorageBinding;
+	}
+	TextureDesc.dimension = WGPUTextureDimension_2D;
+	TextureDesc.size = { Width, Height, 1 };
+	TextureDesc.format = Format;
+	TextureDesc.mipLevelCount = 1;
+	TextureDesc.sampleCount = 1;
+
+	OutTexture.Texture = wgpuDeviceCreateTexture(Context.Device, &TextureDesc);
+	assert(OutTexture.Texture);
+
+	OutTexture.View = wgpuTextureCreateView(OutTexture.Texture, nullptr);
+	assert(OutTexture.View);
+
+	OutTexture.Width = Width;
+	OutTexture.Height = Height;
+	OutTexture.Format = Format;
+	return true;
+}
+
+bool FWebGPUTextureBridge::WritePixels(const void* Data, uint32 Width, uint32 Height, uint32 RowPitch, WGPUTextureFormat Format, FWebGPUTexture& OutTexture) const
+{
+	if (!OutTexture.IsValid() || OutTexture.Width != Width || OutTexture.Height != Height || OutTexture.Format != Format)
+	{
+		if (!CreateTexture(Width, Height, Format, OutTexture))
+		{
+			return false;
+		}
+	}
+
+	//Queue writes take any row pitch, only buffer copies need the 256 byte alignment
+	WGPUTexelCopyTextureInfo Destination = {};
+	Destination.texture = OutTexture.Texture;
+	Destination.aspect = WGPUTextureAspect_All;
+
+	WGPUTexelCopyBufferLayout Layout = {};
+	Layout.bytesPerRow = RowPitch;
+	Layout.rowsPerImage = Height;
+
+	const WGPUExtent3D Extent = { Width, Height, 1 };
+	wgpuQueueWriteTexture(Context.Queue, &Destination, Data, (size_t)RowPitch * Height, &Layout, &Extent);
+	return true;
+}
+
+bool FWebGPUTextureBridge::UploadTexture2D(UTexture2D* Texture, FWebGPUTexture& OutTexture, int32 MipIndex) const
+{
+	FTexturePlatformData* PlatformData = Texture ? Texture->GetPlatformData() : nullptr;
+	if (!PlatformData || !PlatformData->Mips.IsValidIndex(MipIndex))
+	{
+		return false;
+	}
+
+	const WGPUTextureFormat Format = ToWGPUFormat(PlatformData->PixelFormat);
+	if (Format == WGPUTextureFormat_Undefined)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s: pixel format %d has no wgpu equivalent (compressed?)"), *Texture->GetName(), (int32)PlatformData->PixelFormat);
+		return false;
+	}
+
+	FTexture2DMipMap& Mip = PlatformData->Mips[MipIndex];
+	const uint32 RowPitch = Mip.SizeX * GetBytesPerPixel(Format);
+	if (Mip.BulkData.GetBulkDataSize() < (int64)RowPitch * Mip.SizeY)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s: mip %d isn't CPU resident"), *Texture->GetName(), MipIndex);
+		return false;
+	}
+
+	const void* Pixels = Mip.BulkData.LockReadOnly();
+	const bool bWritten = WritePixels(Pixels, Mip.SizeX, Mip.SizeY, RowPitch, Format, OutTexture);
+	Mip.BulkData.Unlock();
+	return bWritten;
+}
+
+bool FWebGPUTextureBridge::UploadRenderTarget(UTextureRenderTarget2D* RenderTarget, FWebGPUTexture& OutTexture) const
+{
+	FTextureRenderTargetResource* Resource = RenderTarget ? RenderTarget->GameThread_GetRenderTargetResource() : nullptr;
+	if (!Resource)
+	{
+		return false;
+	}
+
+	const EPixelFormat PixelFormat = RenderTarget->GetFormat();
+	const WGPUTextureFormat Format = ToWGPUFormat(PixelFormat);
+	if (Format == WGPUTextureFormat_Undefined)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s: pixel format %d has no wgpu equivalent"), *RenderTarget->GetName(), (int32)PixelFormat);
+		return false;
+	}
+
+	const uint32 Width = RenderTarget->SizeX;
+	const uint32 Height = RenderTarget->SizeY;
+
+	//ReadPixels hands back unconverted 8 bit values as BGRA, only the channel order may need a swap
+	if (PixelFormat == PF_B8G8R8A8 || PixelFormat == PF_R8G8B8A8)
+	{
+		TArray<FColor> Pixels;
+		if (!Resource->ReadPixels(Pixels))
+		{
+			return false;
+		}
+		if (PixelFormat == PF_R8G8B8A8)
+		{
+			for (FColor& Pixel : Pixels)
+			{
+				Swap(Pixel.R, Pixel.B);
+			}
+		}
+		return WritePixels(Pixels.GetData(), Width, Height, Width * sizeof(FColor), Format, OutTexture);
+	}
+
+	//Anything else is copied back in its own format, FColor / FLinearColor reads would quantize or convert it
+	TArray<uint8> Pixels;
+	uint32 RowPitch = 0;
+	ENQUEUE_RENDER_COMMAND(WebGPUReadRenderTarget)(
+		[Resource, &Pixels, &RowPitch, BytesPerPixel = GetBytesPerPixel(Format), Height](FRHICommandListImmediate& RHICmdList)
+		{
+			FRHIGPUTextureReadback Readback(TEXT("WebGPURenderTargetReadback"));
+			Readback.EnqueueCopy(RHICmdList, Resource->GetRenderTargetTexture());
+			RHICmdList.BlockUntilGPUIdle();
+
+			int32 RowPitchInPixels = 0;
+			const uint8* Data = static_cast<const uint8*>(Readback.Lock(RowPitchInPixels));
+			if (Data)
+			{
+				RowPitch = RowPitchInPixels * BytesPerPixel;
+				Pixels.Append(Data, (int64)RowPitch * Height);
+			}
+			Readback.Unlock();
+		});
+	FlushRenderingCommands();
+
+	return Pixels.Num() > 0 && WritePixels(Pixels.GetData(), Width, Height, RowPitch, Format, OutTexture);
+}
+
+bool FWebGPUTextureBridge::ReadbackPixels(const FWebGPUTexture& Texture, TArray<uint8>& OutData, uint32& OutRowPitch) const
+{
+	if (!Texture.IsValid())
+	{
+		return false;
+	}
+
+	OutRowPitch = GetAlignedRowPitch(Texture.Width, Texture.Format);
+	const uint64 Size = (uint64)OutRowPitch * Texture.Height;
+
+	//Texture -> buffer copy here, the mapped read goes through the context's readback path
+	WGPUBuffer CopyBuffer = Context.CreateBuffer(Size, WGPUBufferUsage_CopySrc | WGPUBufferUsage_CopyDst, "texture_readback_buffer");
+
+	WGPUTexelCopyTextureInfo Source = {};
+	Source.texture = Texture.Texture;
+	Source.aspect = WGPUTextureAspect_All;
+
+	WGPUTexelCopyBufferInfo Destination = {};
+	Destination.buffer = CopyBuffer;
+	Destination.layout.bytesPerRow = OutRowPitch;
+	Destination.layout.rowsPerImage = Texture.Height;
+
+	const WGPUExtent3D Extent = { Texture.Width, Texture.Height, 1 };
+
+	WGPUCommandEncoder CommandEncoder = wgpuDeviceCreateCommandEncoder(Context.Device, nullptr);
+	wgpuCommandEncoderCopyTextureToBuffer(CommandEncoder, &Source, &Destination, &Extent);
+	Context.Submit(CommandEncoder);
+
+	OutData.SetNumUninitialized(Size);
+	const bool bRead = Context.ReadBufferSync(CopyBuffer, 0, Size, OutData.GetData());
+	if (!bRead)
+	{
+		OutData.Reset();
+	}
+
+	wgpuBufferRelease(CopyBuffer);
+	return bRead;
+}
+
+bool FWebGPUTextureBridge::ReadbackToRenderTarget(const FWebGPUTexture& Texture, UTextureRenderTarget2D* RenderTarget) const
+{
+	FTextureRenderTargetResource* Resource = RenderTarget ? RenderTarget->GameThread_GetRenderTargetResource() : nullptr;
+	if (!Resource || RenderTarget->SizeX != (int32)Texture.Width || RenderTarget->SizeY != (int32)Texture.Height ||
+		ToWGPUFormat(RenderTarget->GetFormat()) != Texture.Format)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Render target doesn't match the %ux%u compute texture format"), Texture.Width, Texture.Height);
+		return false;
+	}
+
+	TArray<uint8> Pixels;
+	uint32 RowPitch = 0;
+	if (!ReadbackPixels(Texture, Pixels, RowPitch))
+	{
+		return false;
+	}
+
+	ENQUEUE_RENDER_COMMAND(WebGPUUpdateRenderTarget)(
+		[Resource, Pixels = MoveTemp(Pixels), RowPitch, Width = Texture.Width, Height = Texture.Height](FRHICommandListImmediate& RHICmdList)
+		{
+			const FUpdateTextureRegion2D Region(0, 0, 0, 0, Width, Height);
+			RHICmdList.UpdateTexture2D(Resource->GetRenderTargetTexture(), 0, Region, RowPitch, Pixels.GetData());
+		});
+	return true;
+}
+
+bool FWebGPUTextureBridge::ReadbackToTexture2D(const FWebGPUTexture& Texture, UTexture2D* Texture2D) const
+{
+	if (!Texture2D || Texture2D->GetSizeX() != (int32)Texture.Width || Texture2D->GetSizeY() != (int32)Texture.Height ||
+		ToWGPUFormat(Texture2D->GetPixelFormat()) != Texture.Format)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Texture doesn't match the %ux%u compute texture format"), Texture.Width, Texture.Height);
+		return false;
+	}
+
+	TArray<uint8>* Pixels = new TArray<uint8>();
+	uint32 RowPitch = 0;
+	if (!ReadbackPixels(Texture, *Pixels, RowPitch))
+	{
+		delete Pixels;
+		return false;
+	}
+
+	//UpdateTextureRegions reads both on the render thread, they're freed by the cleanup callback
+	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, Texture.Width, Texture.Height);
+	Texture2D->UpdateTextureRegions(0, 1, Region, RowPitch, GetBytesPerPixel(Texture.Format), Pixels->GetData(),
+		[Pixels](uint8* SrcData, const FUpdateTextureRegion2D* Regions)
+		{
+			delete Pixels;
+			delete Regions;
+		});
+	return true;
+}
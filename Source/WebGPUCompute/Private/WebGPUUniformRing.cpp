@@ -0,0 +1,175 @@
+#include "WebGPUUniformRing.h"
+#include "WebGPUContext.h"
+
+FWebGPUUniformRing::~FWebGPUUniformRing()
+{
+	Release();
+}
+
+bool FWebGPUUniformRing::Initialize(FWebGPUContext& InContext, uint32 InBytesPerFrame, uint32 InFramesInFlight, uint32 InBindingSize)
+{
+	Release();
+
+	Context = &InContext;
+	BindingSize = Align(FMath::Max(InBindingSize, 16u), 16u);
+	FramesInFlight = FMath::Max(InFramesInFlight, 1u);
+
+	//Each slice must at least hold one full binding window so a dynamic offset never crosses into the next slice
+	BytesPerFrame = Align(FMath::Max(InBytesPerFrame, BindingSize), Alignment);
+
+	Buffer = Context->CreateBuffer((uint64)BytesPerFrame * FramesInFlight, WGPUBufferUsage_Uniform | WGPUBufferUsage_CopyDst, "uniform_ring_buffer");
+	if (!Buffer)
+	{
+		return false;
+	}
+
+	WGPUBindGroupLayoutEntry LayoutEntry = {};
+	LayoutEntry.binding = 0;
+	LayoutEntry.visibility = WGPUShaderStage_Compute;
+	LayoutEntry.buffer.type = WGPUBufferBindingType_Uniform;
+	LayoutEntry.buffer.hasDynamicOffset = true;
+	LayoutEntry.buffer.minBindingSize = 0;
+
+	WGPUBindGroupLayoutDescriptor LayoutDesc = {};
+	LayoutDesc.label = { "uniform_ring_layout", WGPU_STRLEN };
+	LayoutDesc.entryCount = 1;
+	LayoutDesc.entries = &LayoutEntry;
+
+	BindGroupLayout = wgpuDeviceCreateBindGroupLayout(Context->Device, &LayoutDesc);
+	assert(BindGroupLayout);
+
+	WGPUBindGroupEntry BindEntry = {};
+	BindEntry.binding = 0;
+	BindEntry.buffer = Buffer;
+	BindEntry.offset = 0;
+	BindEntry.size = BindingSize;
+
+	WGPUBindGroupDescriptor BindGroupDesc = {};
+	BindGroupDesc.label = { "uniform_ring_bind_group", WGPU_STRLEN };
+	BindGroupDesc.layout = BindGroupLayout;
+	BindGroupDesc.entryCount = 1;
+	BindGroupDesc.entries = &BindEntry;
+
+	BindGroup = wgpuDeviceCreateBindGroup(Context->Device, &BindGroupDesc);
+	assert(BindGroup);
+
+	Shadow.SetNumZeroed(BytesPerFrame);
+	FrameIndex = 0;
+	WrapsSinceSubmit = 0;
+	Head = 0;
+	FlushedHead = 0;
+
+	return true;
+}
+
+void FWebGPUUniformRing::Release()
+{
+	if (BindGroup)
+	{
+		wgpuBindGroupRelease(BindGroup);
+		BindGroup = nullptr;
+	}
+	if (BindGroupLayout)
+	{
+		wgpuBindGroupLayoutRelease(BindGroupLayout);
+		BindGroupLayout = nullptr;
+	}
+	if (Buffer)
+	{
+		wgpuBufferRelease(Buffer);
+		Buffer = nullptr;
+	}
+	Shadow.Empty();
+	Context = nullptr;
+}
+
+void FWebGPUUniformRing::BeginFrame()
+{
+	if (!IsInitialized())
+	{
+		return;
+	}
+
+	Flush();
+
+	//Slice we move into was last written FramesInFlight frames ago, callers that keep
+	//work in flight longer than that must wait on it before allocating
+	FrameIndex++;
+	WrapsSinceSubmit = 0;
+	Head = 0;
+	FlushedHead = 0;
+}
+
+bool FWebGPUUniformRing::Allocate(const void* Data, uint32 Size, uint32& OutDynamicOffset)
+{
+	if (!IsInitialized() || Size > BindingSize)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Uniform ring allocation of %u bytes rejected (binding size %u)"), Size, BindingSize);
+		return false;
+	}
+
+	uint32 Offset = Align(Head, Alignment);
+	if ((uint64)Offset + BindingSize > BytesPerFrame)
+	{
+		//Slice exhausted mid frame (e.g. long benchmark loops without a tick): upload it and move on to the
+		//next slice. Queue writes are ordered after earlier submits, so slices used by submitted work are
+		//safe to overwrite without waiting, but an encoder that hasn't been submitted yet still references
+		//every slice since the last submit and the write would land before it runs.
+		if (WrapsSinceSubmit + 1 >= FramesInFlight)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Uniform ring exhausted: unsubmitted work already spans %u of %u slices (%u bytes each), submit before allocating more"),
+				WrapsSinceSubmit + 1, FramesInFlight, BytesPerFrame);
+			return false;
+		}
+
+		Flush();
+
+		FrameIndex++;
+		WrapsSinceSubmit++;
+		Head = 0;
+		FlushedHead = 0;
+		Offset = 0;
+	}
+
+	FMemory::Memcpy(Shadow.GetData() + Offset, Data, Size);
+
+	//Keep the head 4 byte aligned, queue writes need it
+	Head = Align(Offset + Size, 4u);
+
+	OutDynamicOffset = static_cast<uint32>(GetSliceBase() + Offset);
+	return true;
+}
+
+uint64 FWebGPUUniformRing::GetFreeBlocks(uint32 Size) const
+{
+	if (!IsInitialized() || Size > BindingSize)
+	{
+		return 0;
+	}
+
+	//Same placement rule as Allocate: a block fits while its binding window stays inside the slice
+	const uint64 Stride = Align(FMath::Max(Size, 1u), Alignment);
+	const uint64 BlocksPerSlice = (BytesPerFrame - BindingSize) / Stride + 1;
+
+	const uint64 Offset = Align(Head, Alignment);
+	const uint64 InCurrentSlice = Offset + BindingSize <= BytesPerFrame ? (BytesPerFrame - BindingSize - Offset) / Stride + 1 : 0;
+
+	//Allocate moves on to a fresh slice until the unsubmitted work spans FramesInFlight of them
+	return InCurrentSlice + (FramesInFlight - 1 - WrapsSinceSubmit) * BlocksPerSlice;
+}
+
+void FWebGPUUniformRing::Flush()
+{
+	if (!IsInitialized() || Head <= FlushedHead)
+	{
+		return;
+	}
+
+	wgpuQueueWriteBuffer(Context->Queue, Buffer, GetSliceBase() + FlushedHead, Shadow.GetData() + FlushedHead, Head - FlushedHead);
+	FlushedHead = Head;
+}
+
+void FWebGPUUniformRing::MarkSubmitted()
+{
+	WrapsSinceSubmit = 0;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+* Summary of a set of timing samples (seconds or any other unit). Percentiles use linear
+* interpolation between the closest ranks, so p50 of an even count is the mean of the middle two.
+* Optional outlier rejection drops samples outside the Tukey fences (1.5 IQR beyond the quartiles)
+* before anything else is computed, so one preempted run doesn't skew the mean or the spread.
+*/
+struct FBenchmarkStats
+{
+	int32 Num = 0;
+	double Min = 0.0;
+	double Max = 0.0;
+	double Mean = 0.0;
+	double P50 = 0.0;
+	double P95 = 0.0;
+	double P99 = 0.0;
+
+	//Sample standard deviation and coefficient of variation (StdDev / Mean)
+	double StdDev = 0.0;
+	double CV = 0.0;
+
+	//Samples dropped as outliers, not included in Num
+	int32 NumRejected = 0;
+
+	double Median() const { return P50; }
+
+	//P in [0, 1], Sorted ascending and non-empty
+	static double Percentile(const TArray<double>& Sorted, double P)
+	{
+		const double Rank = FMath::Clamp(P, 0.0, 1.0) * (Sorted.Num() - 1);
+		const int32 Lower = (int32)Rank;
+		const int32 Upper = FMath::Min(Lower + 1, Sorted.Num() - 1);
+		return Sorted[Lower] + (Sorted[Upper] - Sorted[Lower]) * (Rank - Lower);
+	}
+
+	static FBenchmarkStats Compute(TArray<double> Samples, bool bRejectOutliers = false)
+	{
+		FBenchmarkStats Stats;
+		if (Samples.Num() == 0)
+		{
+			return Stats;
+		}
+
+		Samples.Sort();
+
+		//Quartiles of fewer than 4 samples say nothing about outliers
+		if (bRejectOutliers && Samples.Num() >= 4)
+		{
+			const double Q1 = Percentile(Samples, 0.25);
+			const double Q3 = Percentile(Samples, 0.75);
+			const double Fence = 1.5 * (Q3 - Q1);
+			const int32 NumBefore = Samples.Num();
+			Samples.RemoveAll([Low = Q1 - Fence, High = Q3 + Fence](double Sample) { return Sample < Low || Sample > High; });
+			Stats.NumRejected = NumBefore - Samples.Num();
+		}
+
+		double Total = 0.0;
+		for (double Sample : Samples)
+		{
+			Total += Sample;
+		}
+
+		Stats.Num = Samples.Num();
+		Stats.Min = Samples[0];
+		Stats.Max = Samples.Last();
+		Stats.Mean = Total / Samples.Num();
+
+		double SquaredError = 0.0;
+		for (double Sample : Samples)
+		{
+			SquaredError += (Sample - Stats.Mean) * (Sample - Stats.Mean);
+		}
+		Stats.StdDev = Samples.Num() > 1 ? FMath::Sqrt(SquaredError / (Samples.Num() - 1)) : 0.0;
+		Stats.CV = Stats.Mean != 0.0 ? Stats.StdDev / Stats.Mean : 0.0;
+
+		Stats.P50 = Percentile(Samples, 0.50);
+		Stats.P95 = Percentile(Samples, 0.95);
+		Stats.P99 = Percentile(Samples, 0.99);
+		return Stats;
+	}
+
+	//"p50 x, p95 y, p99 z (min a, mean b, sd c, cv d%, n e)" with every value multiplied by Scale, e.g. 1e6 for seconds -> us
+	FString ToString(double Scale = 1.0, const TCHAR* Unit = TEXT("")) const
+	{
+		FString Result = FString::Printf(TEXT("p50 %.2f%s, p95 %.2f%s, p99 %.2f%s (min %.2f%s, mean %.2f%s, sd %.2f%s, cv %.1f%%, n %d"),
+			P50 * Scale, Unit, P95 * Scale, Unit, P99 * Scale, Unit, Min * Scale, Unit, Mean * Scale, Unit, StdDev * Scale, Unit, CV * 100.0, Num);
+		if (NumRejected > 0)
+		{
+			Result += FString::Printf(TEXT(", %d outliers dropped"), NumRejected);
+		}
+		return Result + TEXT(")");
+	}
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+//Per function instruction set targets, so wide SIMD kernels can live in a translation unit built for the
+//baseline ISA and only run after FCPUFeatures says so. MSVC emits any intrinsic without flags.
+#if defined(__GNUC__) || defined(__clang__)
+#define CPU_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define CPU_TARGET_AVX __attribute__((target("avx")))
+#define CPU_TARGET_AVX2_FMA __attribute__((target("avx2,fma")))
+#define CPU_TARGET_AVX512F __attribute__((target("avx512f")))
+#else
+#define CPU_TARGET_SSE42
+#define CPU_TARGET_AVX
+#define CPU_TARGET_AVX2_FMA
+#define CPU_TARGET_AVX512F
+#endif
+
+//Ordered from narrowest to widest
+enum class ECPUSimdLevel : uint8
+{
+	Scalar,
+	SSE42,
+	AVX,
+	AVX2_FMA,
+	AVX512F,
+};
+
+//One CPUID cache descriptor (leaf 4 on Intel, 0x8000001D on AMD)
+struct FCPUCacheInfo
+{
+	int32 Level = 0;
+	bool bData = false;
+	bool bInstruction = false;
+	uint32 SizeBytes = 0;
+	uint32 LineSize = 0;
+	uint32 Ways = 0;
+
+	//Logical processors sharing this cache, e.g. 2 for a per-core cache with SMT
+	uint32 SharedBy = 0;
+};
+
+/**
+* Instruction sets that are safe to execute on this machine, detected once at runtime.
+* AVX and AVX-512 need both the CPUID bits (leaf 1 / leaf 7) and the OS saving their
+* register state on context switches (XCR0 via XGETBV), otherwise they fault.
+* Everything is false on non-x86 CPUs.
+*/
+struct WEBGPUCOMPUTE_API FCPUFeatures
+{
+	bool bSSE2 = false;
+	bool bSSE42 = false;
+	bool bAVX = false;
+	bool bAVX2 = false;
+	bool bFMA = false;
+	bool bAVX512F = false;
+
+	//XCR0 state, reported separately so logs can tell "CPU lacks it" from "OS disabled it"
+	bool bOSSavesYMM = false;
+	bool bOSSavesZMM = false;
+
+	//"GenuineIntel", "AuthenticAMD", ... empty off x86
+	FString Vendor;
+
+	//Deterministic cache parameters, empty if the cpu doesn't report them
+	TArray<FCPUCacheInfo> Caches;
+
+	//Data or unified cache size of Level (1-3) in bytes, 0 if unknown
+	uint32 GetCacheSize(int32 Level) const;
+
+	static const FCPUFeatures& Get();
+
+	//Widest level every instruction of which is usable, AVX2_FMA needs both AVX2 and FMA
+	ECPUSimdLevel GetBestSimdLevel() const;
+	bool Supports(ECPUSimdLevel Level) const { return Level <= GetBestSimdLevel(); }
+
+	static const TCHAR* GetSimdLevelName(ECPUSimdLevel Level);
+	FString ToString() const;
+
+private:
+	static FCPUFeatures Detect();
+};
@@ -1,18 +1,70 @@
 #pragma once
 
+#include "CPUFeatures.h"
+
+class FBenchmarkThreadPool;
+
 /**
-* General utility class to identify speed (for now, bandwidth later)
+* General utility class to identify speed (compute throughput and memory bandwidth)
 * of hardware currently running, this can give information about
 * what kind of additional tuning we want to do.
 */
 class FFlopBenchmark
 {
 public:
+	FFlopBenchmark();
+	~FFlopBenchmark();
+
+	//Every benchmark autoscales its iteration count until one repetition takes MinRepetitionSeconds
+	//(that run doubles as the first warmup), runs the remaining warmups, then reports the median and
+	//spread of Repetitions timed runs. Passed in iteration counts are only the starting point.
+	struct FHarnessSettings
+	{
+		int32 WarmupRuns = 1;
+		int32 Repetitions = 10;
+		double MinRepetitionSeconds = 0.05;
+		bool bRejectOutliers = true;
+
+		//Pins pool workers to one logical processor per physical core first, then the SMT siblings (first 64
+		//logical processors only). Takes effect on the next benchmark.
+		bool bPinThreads = false;
+	};
+
+	FHarnessSettings Harness;
+
 	void PrintCPUIDInfo();
 	float GetCPUFrequencyMHz();
 	bool SupportsAVX2();
 	bool SupportsAVX512();
-	void BenchmarkCPUScalar(int32 ThreadCount, uint64 IterationsPerThread);
-	void BenchmarkAVX2(uint64 Iterations);
-	void BenchmarkAVX512(uint64 Iterations);
+
+	//Peak multiply-add GFLOPs from independent accumulator chains. bLatency runs a single dependent
+	//chain instead, which reports the latency of one multiply-add rather than throughput.
+	void BenchmarkCPUScalar(int32 ThreadCount, uint64 IterationsPerThread, bool bLatency = false);
+
+	//Both fall back to BenchmarkSIMD with a warning when the cpu or OS can't run them
+	void BenchmarkAVX2(uint64 Iterations, bool bLatency = false);
+	void BenchmarkAVX512(uint64 Iterations, bool bLatency = false);
+
+	//Widest vector kernel FCPUFeatures reports as safe, on every hardware thread
+	void BenchmarkSIMD(uint64 Iterations, bool bLatency = false);
+
+	//Throughput GFLOPs, speedup and parallel efficiency for 1..MaxThreads threads (<= 0 for every
+	//hardware thread) with a fixed amount of work per thread. bVector uses the widest usable SIMD
+	//kernel, otherwise scalar. With bPinThreads, a drop past the physical core count is SMT siblings sharing a core.
+	void BenchmarkScaling(int32 MaxThreads, uint64 Iterations, bool bVector);
+
+	//STREAM copy/scale/add/triad GB/s for every power of two working set (all three arrays) between
+	//MinBytes and MaxBytes, split across ThreadCount threads. Non-temporal stores bypass the caches,
+	//which helps once the working set is past the last level cache and hurts below it.
+	void BenchmarkBandwidth(int32 ThreadCount, uint64 MinBytes, uint64 MaxBytes, bool bNonTemporal);
+
+	//Single threaded random pointer chase, ns per dependent load for working sets between MinBytes and
+	//MaxBytes. Cache sizes and memory latency are inferred from the jumps in the curve and checked
+	//against the CPUID cache descriptors (see PrintCPUIDInfo).
+	void BenchmarkLatency(uint64 MinBytes, uint64 MaxBytes);
+
+private:
+	//Persistent workers shared by every benchmark of this instance, created on first use
+	FBenchmarkThreadPool& GetPool(int32 ThreadCount);
+	TUniquePtr<FBenchmarkThreadPool> Pool;
 };
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "webgpu/webgpu.h"
+
+class FWebGPUContext;
+
+/**
+* GPU counterpart to FFlopBenchmark. Times the built-in compute primitives on
+* the device and the equivalent CPU code on the same data, checks the results
+* agree and logs throughput for both.
+*/
+class WEBGPUCOMPUTE_API FWebGPUBenchmark
+{
+public:
+	explicit FWebGPUBenchmark(FWebGPUContext& InContext);
+
+	//Exclusive uint32 scan, GPU reduce-then-scan vs a ParallelFor blocked scan
+	void BenchmarkScan(int32 NumElements, int32 Iterations);
+
+	//uint32 keys (and key+payload) GPU radix sort vs Algo::Sort and a ParallelFor merge sort
+	void BenchmarkRadixSort(int32 NumKeys, int32 Iterations);
+
+	//Square Size x Size tiled GEMM GFLOPs, f32 or f16 storage, next to a ParallelFor CPU GEMM
+	void BenchmarkGemm(int32 Size, int32 Iterations, bool bFloat16);
+
+	//TileSize^2 noise tiles/s per noise type (fBm of Octaves, plus a domain warped variant) vs the
+	//ParallelFor cpu reference, which also checks the last gpu tile
+	void BenchmarkNoise(int32 TileSize, int32 Iterations, int32 Octaves);
+
+	//Peak FMA throughput in f32, f16 (ShaderF16) and f64 (WGPUNativeFeature_ShaderF64), each
+	//invocation runs independent vec4 FMA chains so the result is throughput rather than latency
+	void BenchmarkFlops(int32 Iterations);
+
+	//STREAM style copy (a = b) and triad (a = b + s * c) over vec4<f32> storage buffers, GB/s for every
+	//power of two working set (all three arrays) from MinBytes up to MaxBytes or the binding size limit
+	void BenchmarkBandwidth(uint64 MinBytes, uint64 MaxBytes);
+
+	//Host <-> device copies for every 4x size step from MinBytes to MaxBytes (clamped to maxBufferSize).
+	//Upload via wgpuQueueWriteBuffer, a mappedAtCreation buffer and a two slot MapWrite staging ring,
+	//readback via ReadBufferSync and a two slot MapRead staging ring. Wall time, since the host copy and
+	//mapping are part of the cost. Also logs LatencyIterations 4 KB round trips per path.
+	void BenchmarkTransfer(uint64 MinBytes, uint64 MaxBytes, int32 LatencyIterations);
+
+	//Fixed costs of small jobs, Iterations samples each, reported as percentiles:
+	//- RunExampleShader style round trip of an empty kernel, split into encode, submit and wait
+	//- dispatches/s with all dispatches in one submit vs one submit per dispatch
+	//- wgpuDevicePoll with nothing pending, and blocking on an empty submit (fence signal + wake)
+	void BenchmarkDispatch(int32 Iterations, int32 DispatchesPerBatch);
+
+	//CreateShaderModule (WGSL parse + validation) vs CreateComputePipeline (backend + driver compile) for a
+	//small corpus of kernels, cold (unique source every time) and cached (same source again), p50/p95/p99.
+	//p50s are compared against Saved/WebGPUCompute/CompileBaseline_<backend>.csv, anything more than
+	//Tolerance slower is logged as a regression. The baseline is written when missing or bUpdateBaseline is set.
+	//Returns false on regressions or compile failures.
+	bool BenchmarkShaderCompile(int32 Iterations, float Tolerance, bool bUpdateBaseline);
+
+	//Records Encode into one compute pass and returns its duration. Uses GPU timestamps at the
+	//pass boundaries when the device has TimestampQuery, submit-to-idle wall time otherwise.
+	double TimeComputePass(TFunctionRef<void(WGPUComputePassEncoder)> Encode, bool* bOutUsedTimestamps = nullptr);
+
+private:
+	//Blocks until everything submitted so far has finished
+	void WaitForGPU();
+
+	FWebGPUContext& Context;
+};
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUKernel.h"
+#include "WebGPUReduction.h"
+#include "WebGPUScan.h"
+
+/**
+* Fixed capacity GPU array with a GPU-side element counter, the target of filtering
+* kernels. Kernels bind the data and the counter (as atomic<u32>) and append with
+*
+*	let slot = atomicAdd(&count, 1u);
+*	if (slot < arrayLength(&data)) { data[slot] = value; }
+*
+* The counter keeps counting past the capacity, so a count above GetCapacity() means
+* appends were dropped. It can feed FWebGPUIndirectDispatch::EncodeCountToArgs directly.
+*/
+class WEBGPUCOMPUTE_API FWebGPUAppendBuffer
+{
+public:
+	~FWebGPUAppendBuffer();
+
+	bool Create(FWebGPUContext& InContext, uint32 InCapacity, uint32 InElementSize = sizeof(uint32), const char* Label = "append_buffer");
+	void Release();
+	bool IsValid() const { return DataBuffer != nullptr; }
+
+	//Queue write, lands before the next submit
+	void ResetCount();
+
+	//Blocking reads, ReadElements only transfers the first min(count, capacity) elements
+	uint32 ReadCount() const;
+	bool ReadElements(void* OutData, uint32 NumElements) const;
+
+	template<typename T>
+	bool ReadBack(TArray<T>& OutData) const
+	{
+		if (sizeof(T) != ElementSize)
+		{
+			return false;
+		}
+
+		const uint32 Count = ReadCount();
+		if (Count > Capacity)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Append buffer overflow: %u appends for %u slots"), Count, Capacity);
+		}
+		OutData.SetNumUninitialized(FMath::Min(Count, Capacity));
+		return ReadElements(OutData.GetData(), OutData.Num());
+	}
+
+	WGPUBuffer GetDataBuffer() const { return DataBuffer; }
+	WGPUBuffer GetCounterBuffer() const { return CounterBuffer; }
+	uint32 GetCapacity() const { return Capacity; }
+	uint32 GetElementSize() const { return ElementSize; }
+
+private:
+	FWebGPUContext* Context = nullptr;
+	WGPUBuffer DataBuffer = nullptr;
+	WGPUBuffer CounterBuffer = nullptr;
+	uint32 Capacity = 0;
+	uint32 ElementSize = 0;
+};
+
+enum class EWebGPUCompactMethod : uint8
+{
+	//Flags, exclusive scan, scatter. Survivors keep their input order.
+	Scan,
+	//One workgroup-local count and one global atomicAdd per workgroup. Faster, order across workgroups is arbitrary.
+	Atomic,
+};
+
+/**
+* Stream compaction: appends the elements of a 4 byte scalar buffer that pass a WGSL
+* predicate to an FWebGPUAppendBuffer, so only the survivors and their count need to
+* come back to the CPU. The predicate is the body of fn keep(v: SCALAR_T, index: u32) -> bool,
+* the default drops the 0xffffffff sentinel (e.g. the overflow marker of the Collatz example).
+* Both methods append after the buffer's current count, reset it to start over.
+*/
+class WEBGPUCOMPUTE_API FWebGPUCompaction
+{
+public:
+	~FWebGPUCompaction();
+
+	bool Initialize(FWebGPUContext& InContext, EWebGPUScalarType InType = EWebGPUScalarType::UInt32, const FString& KeepSource = FString(SentinelKeepSource));
+	void Release();
+	bool IsInitialized() const { return AtomicKernel.IsValid(); }
+
+	bool EncodeCompact(WGPUComputePassEncoder Pass, WGPUBuffer Input, uint32 Count, const FWebGPUAppendBuffer& Output, EWebGPUCompactMethod Method = EWebGPUCompactMethod::Scan);
+
+	//Resets Output's count, encodes and submits. Read the result with Output.ReadBack.
+	bool Compact(WGPUBuffer Input, uint32 Count, FWebGPUAppendBuffer& Output, EWebGPUCompactMethod Method = EWebGPUCompactMethod::Scan);
+
+	static constexpr const TCHAR* SentinelKeepSource = TEXT("return bitcast<u32>(v) != 0xffffffffu;");
+	static constexpr uint32 WorkgroupSize = 256;
+
+private:
+	struct FCompactParams
+	{
+		uint32 Count;
+		uint32 Pad0;
+		uint32 Pad1;
+		uint32 Pad2;
+	};
+
+	FWebGPUContext* Context = nullptr;
+	EWebGPUScalarType Type = EWebGPUScalarType::UInt32;
+
+	FWebGPUKernel FlagsKernel;
+	FWebGPUKernel ScatterKernel;
+	FWebGPUKernel FinishKernel;
+	FWebGPUKernel AtomicKernel;
+	FWebGPUScan Scan;
+
+	//Grow-only keep flags and their exclusive scan, capacities in bytes
+	WGPUBuffer Flags = nullptr;
+	WGPUBuffer Offsets = nullptr;
+	uint64 FlagsCapacity = 0;
+	uint64 OffsetsCapacity = 0;
+};
@@ -2,8 +2,15 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "WebGPUReduction.h"
+#include "WebGPUNoise.h"
 #include "WebGPUComponent.generated.h"
 
+class UTexture;
+class UTextureRenderTarget2D;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FWebGPUPipelinedResultSignature, const TArray<int32>&, Result, int64, FrameIndex);
+
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class WEBGPUCOMPUTE_API UWebGPUComponent : public UActorComponent
 {
@@ -20,14 +27,151 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Utility")
 	void PrintCPUInfo();
 
+	//CPU FLOPs, followed by peak f32/f16/f64 GFLOPs of the gpu (timestamp timed) when bCompareGPU is set.
+	//bTestAVX runs AVX2 (or AVX-512 with bAVX512) on every core, dropping to the widest usable kernel if the cpu lacks it.
+	//bLatency times a single dependent multiply-add chain instead of peak throughput. GPUIterations is how many dispatches
+	//go into each gpu case's timed pass
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void BenchmarkFlops(int32 Threads = 1, int64 Iterations = 1000000, bool bTestAVX = false, bool bAVX512 = false, bool bCompareGPU = true, bool bLatency = false, int32 GPUIterations = 10);
+
+	//CPU GFLOPs and parallel efficiency for 1..MaxThreads threads (<= 0 uses every hardware thread) on a persistent pool,
+	//optionally pinning workers one per physical core first and only then onto the SMT siblings, so the
+	//knee where threads start sharing a core shows up in the curve. Exposes SMT and P-core / E-core effects
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void BenchmarkScaling(int32 MaxThreads = 0, int64 Iterations = 1000000, bool bVector = true, bool bPinThreads = false);
+
+	//STREAM copy/scale/add/triad GB/s per working set size on the cpu (Threads <= 0 uses every core),
+	//followed by gpu storage buffer copy/triad over the same sizes when bCompareGPU is set
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void BenchmarkBandwidth(int32 Threads = 0, int64 MinBytes = 16384, int64 MaxBytes = 1073741824, bool bNonTemporal = false, bool bCompareGPU = true);
+
+	//CPU pointer-chase ns per load from 4 KB to 1 GB, with inferred L1/L2/L3 sizes checked against CPUID and memory latency
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void BenchmarkLatency(int64 MinBytes = 4096, int64 MaxBytes = 1073741824);
+
+	//Upload / readback GB/s from 4 KB to 1 GB for every transfer path, plus small round trip latency
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void BenchmarkTransfer(int64 MinBytes = 4096, int64 MaxBytes = 1073741824, int32 LatencyIterations = 100);
+
+	//Empty kernel round trip latency, dispatches/s batched vs submit per dispatch and poll wake latency (p50/p95/p99)
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void BenchmarkDispatch(int32 Iterations = 200, int32 DispatchesPerBatch = 1000);
+
+	//Shader module vs pipeline creation latency, cold and cached, checked against a per backend baseline in Saved/.
+	//Returns false if anything got more than Tolerance slower than the baseline (or failed to compile).
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool BenchmarkShaderCompile(int32 Iterations = 20, float Tolerance = 0.25f, bool bUpdateBaseline = false);
+
+	//Exclusive uint32 prefix sum on the gpu vs a ParallelFor scan on the cpu
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void BenchmarkScan(int32 NumElements = 16777216, int32 Iterations = 10);
+
+	//GPU radix sort keys/s (keys only and key+payload) vs Algo::Sort and a parallel cpu sort
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void BenchmarkRadixSort(int32 NumKeys = 4194304, int32 Iterations = 5);
+
+	//Tiled GEMM GFLOPs on the gpu, logged in the same format as BenchmarkFlops' cpu numbers
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void BenchmarkGemm(int32 Size = 1024, int32 Iterations = 10, bool bFloat16 = false);
+
+	//Noise tiles/s on the gpu vs the cpu reference for every noise type, also checks they agree
 	UFUNCTION(BlueprintCallable, Category = "Utility")
-	void BenchmarkFlops(int32 Threads = 1, int64 Iterations = 1000000, bool bTestAVX = false, bool bAVX512 = false);
+	void BenchmarkNoise(int32 TileSize = 512, int32 Iterations = 20, int32 Octaves = 6);
 
 	//Example shader with int array data in/out bind
 	//Todo: generalize data binding (auto generate binds)
 	UFUNCTION(BlueprintCallable, Category = "Utility")
 	void RunShader(const FString& ShaderSource, const TArray<int32>& InData, TArray<int32>& OutData);
 
+	//Same bind as RunShader, dispatched once per ParamsPerDispatch sized block of Params.
+	//Each block is visible as var<uniform> at @group(1) @binding(0) (max 256 bytes).
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void RunShaderWithParams(const FString& ShaderSource, const TArray<int32>& InData, const TArray<float>& Params, int32 ParamsPerDispatch, TArray<int32>& OutData);
+
+	//Producer writes data and an element count (@binding(1)), consumer is dispatched indirectly
+	//from that count without a cpu readback in between. OutData holds the first count elements.
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void RunShaderChainIndirect(const FString& ProducerSource, const FString& ConsumerSource, int32 ConsumerWorkgroupSize, const TArray<int32>& InData, TArray<int32>& OutData);
+
+	//Pipelined mode: frames are submitted without waiting and their results arrive
+	//FramesInFlight - 1 frames later (2-3 in flight) via tick/OnPipelinedResult
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool StartPipelinedShader(const FString& ShaderSource, int32 FramesInFlight = 3);
+
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	void StopPipelinedShader();
+
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool SubmitPipelinedFrame(const TArray<int32>& InData);
+
+	//Most recent result that finished on the gpu, false until the first one lands
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool GetLatestPipelinedResult(TArray<int32>& OutData, int64& FrameIndex) const;
+
+	//Runs the kernel over InData in MaxChunkBytes sized pieces (0 = sized from device limits),
+	//see FWebGPUStreamingExecutor for the shader contract. For multi-GB inputs use the executor directly.
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool RunShaderStreamed(const FString& ShaderSource, const TArray<int32>& InData, TArray<int32>& OutData, int64 MaxChunkBytes = 0);
+
+	//Streams a binary file of u32 elements through the kernel into OutputPath with a bounded
+	//working set (memory mapped input windows, chunked output writes). Same contract as RunShaderStreamed.
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool RunShaderOnFile(const FString& ShaderSource, const FString& InputPath, const FString& OutputPath, int64 MaxChunkBytes = 0);
+
+	//RunShader followed by gpu stream compaction: elements the shader set to 0xffffffff (-1) are
+	//dropped before readback, e.g. Collatz overflows. bPreserveOrder picks the scan based path
+	//over the faster atomic append.
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool RunShaderCompacted(const FString& ShaderSource, const TArray<int32>& InData, TArray<int32>& OutData, bool bPreserveOrder = true);
+
+	//Sum/Min/Max/ArgMax over InData on the gpu, only the result is read back.
+	//OutIndex is the (lowest) position of the maximum for ArgMax, INDEX_NONE otherwise.
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool ReduceFloats(const TArray<float>& InData, EWebGPUReduceOp Op, float& OutValue, int32& OutIndex);
+
+	//Same as ReduceFloats, bUnsigned treats the bits as uint32 for Min/Max/ArgMax
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool ReduceInts(const TArray<int32>& InData, EWebGPUReduceOp Op, bool bUnsigned, int32& OutValue, int32& OutIndex);
+
+	//Counts InData into NumBins equal bins over [MinValue, MaxValue] on the gpu (max 4096 bins),
+	//values outside the range are skipped. Only the bins are read back.
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool HistogramFloats(const TArray<float>& InData, int32 NumBins, float MinValue, float MaxValue, TArray<int32>& OutBins);
+
+	//Integer variant, the inclusive range is split into bins of equal integer width
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool HistogramInts(const TArray<int32>& InData, int32 NumBins, int32 MinValue, int32 MaxValue, TArray<int32>& OutBins);
+
+	//Image kernel without int array round trips: InputTexture (UTexture2D with CPU resident uncompressed mips,
+	//or a render target) is bound as @group(0) @binding(0) texture_2d, OutputTarget as @binding(1)
+	//texture_storage_2d<format, write> in the target's format (e.g. rgba16float, r32float, rgba8unorm).
+	//Dispatched as @workgroup_size(8, 8) tiles over the target.
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool RunTextureShader(const FString& ShaderSource, UTexture* InputTexture, UTextureRenderTarget2D* OutputTarget);
+
+	//Blurs a row-major Width x Height float image (height map, mask) on the gpu with clamped edges.
+	//Gaussian of Sigma by default, with bBoxBlur Sigma is rounded to the box radius.
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool BlurImage(const TArray<float>& InData, int32 Width, int32 Height, float Sigma, TArray<float>& OutData, bool bBoxBlur = false);
+
+	//Row-major Width x Height noise field (Octaves > 1 gives fBm), Frequency in lattice cells per pixel.
+	//Origin is the pixel offset of the first texel, so neighbouring terrain tiles line up. Same seed, same field.
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool GenerateNoise(int32 Width, int32 Height, EWebGPUNoiseType NoiseType, int32 Seed, float Frequency, int32 Octaves, float WarpStrength, FVector2D Origin, TArray<float>& OutData);
+
+	//Complex FFT of (X = re, Y = im) samples, 1D of length Width when Height <= 1, otherwise row-major 2D.
+	//InData may hold several signals back to back, any length works (non powers of two via Bluestein).
+	//Inverse results are scaled by 1/N.
+	UFUNCTION(BlueprintCallable, Category = "Utility")
+	bool FFTComplex(const TArray<FVector2D>& InData, int32 Width, int32 Height, bool bInverse, TArray<FVector2D>& OutData);
+
+	//Device/queue access for the C++ compute helpers (kernels, streaming, primitives)
+	class FWebGPUContext* GetWebGPUContext();
+
+	//Fires from TickComponent whenever a newer pipelined frame has been read back
+	UPROPERTY(BlueprintAssignable, Category = "Utility")
+	FWebGPUPipelinedResultSignature OnPipelinedResult;
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -36,5 +180,11 @@ public:
 
 protected:
 
+	//Lazily brings up instance/adapter/device on first use
+	void EnsureStarted();
+
 	class FWebGPUInternal* Internal = nullptr;
+
+	TArray<int32> LatestPipelinedResult;
+	int64 LatestPipelinedFrame = INDEX_NONE;
 };
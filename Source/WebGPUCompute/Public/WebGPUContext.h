@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "webgpu/webgpu.h"
+#include "webgpu/wgpu.h"
+#include "WebGPUUniformRing.h"
+
+/**
+* Device/queue handles plus the boilerplate every compute helper needs
+* (shader compile behind an error scope, buffer creation, blocking readback).
+* Owned by the component internals, helpers only borrow it.
+*/
+class WEBGPUCOMPUTE_API FWebGPUContext
+{
+public:
+	struct ErrorUserData
+	{
+		bool bDidError = false;
+	};
+	ErrorUserData AnyErrorUserData;
+
+	//Compiles WGSL source, returns nullptr (and logs) if validation failed
+	WGPUShaderModule CreateShaderModule(const FString& Source, const char* Label = "shader.wgsl");
+
+	//Pass a nullptr layout to let the pipeline derive it from the shader. Constants set WGSL override values.
+	WGPUComputePipeline CreateComputePipeline(WGPUShaderModule ShaderModule, WGPUPipelineLayout Layout = nullptr, const char* EntryPoint = "main", const TArray<WGPUConstantEntry>& Constants = {});
+
+	WGPUBuffer CreateBuffer(uint64 Size, WGPUBufferUsage Usage, const char* Label);
+
+	//Copies a range of a CopySrc buffer through a temporary staging buffer, blocks until mapped
+	bool ReadBufferSync(WGPUBuffer Buffer, uint64 Offset, uint64 Size, void* OutData);
+
+	//Optional device features, native ones (WGPUNativeFeature_*) go through the same call
+	bool HasFeature(WGPUFeatureName Feature) const;
+	bool HasNativeFeature(WGPUNativeFeature Feature) const { return HasFeature((WGPUFeatureName)Feature); }
+
+	//Flushes pending uniform ring blocks, then finishes and submits the encoder (and releases it)
+	void Submit(WGPUCommandEncoder CommandEncoder);
+
+	//Shared per-frame parameter ring, created on first use
+	FWebGPUUniformRing& GetUniformRing();
+
+	//Device limits, queried once per device. Falls back to the WebGPU defaults if the query fails.
+	const WGPULimits& GetLimits() const;
+	uint32 GetMaxWorkgroupsPerDimension() const { return FMath::Max(GetLimits().maxComputeWorkgroupsPerDimension, 1u); }
+
+	//Splits NumGroups workgroups into X (up to maxComputeWorkgroupsPerDimension) and Y, kernels
+	//rebuild the flat index as wid.y * num_workgroups.x + wid.x and bounds check it
+	void GetGroupCounts(uint64 NumGroups, uint32& OutX, uint32& OutY) const;
+
+	//Grow-only scratch buffer: recreated with Size bytes when Capacity is smaller, otherwise left as is.
+	//Releasing the old buffer mid pass is fine, bind groups recorded earlier hold their own reference
+	//to it until they are released, and the encoder keeps it alive until the work is done.
+	WGPUBuffer EnsureScratchBuffer(WGPUBuffer& Buffer, uint64& Capacity, uint64 Size, WGPUBufferUsage Usage, const char* Label);
+
+	WGPUInstance Instance = nullptr;
+	WGPUAdapter Adapter = nullptr;
+	WGPUDevice Device = nullptr;
+	WGPUQueue Queue = nullptr;
+
+	//Per-frame parameter blocks, advanced by the owner once per frame
+	FWebGPUUniformRing UniformRing;
+
+private:
+	mutable WGPULimits CachedLimits = {};
+	mutable WGPUDevice CachedLimitsDevice = nullptr;
+};
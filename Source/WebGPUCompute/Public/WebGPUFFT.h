@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUKernel.h"
+
+/**
+* Batched complex FFT over float2 (re, im) buffers. Power of two lengths run as
+* Stockham autosort passes of radix 8, 4 and 2 (no bit reversal, ping-pong between
+* scratch buffers), any other length goes through Bluestein's chirp-z transform on
+* a padded power of two. 2D transforms are row FFTs, a tiled transpose, row FFTs
+* again and a transpose back. Twiddles, chirps and the chirp spectrum live in a
+* plan per length that is built on first use, so repeat transforms of a size only
+* record dispatches. Inverse transforms are scaled by 1/N.
+* Real signals go in as complex values with a zero imaginary part.
+*/
+class WEBGPUCOMPUTE_API FWebGPUFFT
+{
+public:
+	~FWebGPUFFT();
+
+	bool Initialize(FWebGPUContext& InContext);
+	void Release();
+	bool IsInitialized() const { return Context != nullptr; }
+
+	//Batch contiguous signals of N float2 elements, Input is left untouched and must not alias Output
+	bool EncodeFFT1D(WGPUComputePassEncoder Pass, WGPUBuffer Input, WGPUBuffer Output, uint32 N, uint32 Batch, bool bInverse);
+
+	//Batch row-major Width x Height images, same aliasing rules as 1D
+	bool EncodeFFT2D(WGPUComputePassEncoder Pass, WGPUBuffer Input, WGPUBuffer Output, uint32 Width, uint32 Height, uint32 Batch, bool bInverse);
+
+	//Encode and submit, don't wait or read back
+	bool FFT1D(WGPUBuffer Input, WGPUBuffer Output, uint32 N, uint32 Batch, bool bInverse);
+	bool FFT2D(WGPUBuffer Input, WGPUBuffer Output, uint32 Width, uint32 Height, uint32 Batch, bool bInverse);
+
+	static constexpr uint32 WorkgroupSize = 64;
+	static constexpr uint32 TransposeTile = 16;
+
+private:
+	struct FStockhamParams
+	{
+		uint32 N;
+		uint32 Ns;
+		uint32 Batch;
+		uint32 Inverse;
+		float Scale;
+		uint32 Pad0;
+		uint32 Pad1;
+		uint32 Pad2;
+	};
+
+	struct FBluesteinParams
+	{
+		uint32 N;
+		uint32 M;
+		uint32 Batch;
+		uint32 Inverse;
+		float Scale;
+		uint32 Pad0;
+		uint32 Pad1;
+		uint32 Pad2;
+	};
+
+	struct FTransposeParams
+	{
+		uint32 Width;
+		uint32 Height;
+		uint32 Pad0;
+		uint32 Pad1;
+	};
+
+	struct FFFTPlan
+	{
+		uint32 N = 0;
+
+		//Power of two: radix per Stockham pass and N twiddles e^(-2 pi i k / N)
+		TArray<uint32> Radices;
+		WGPUBuffer Twiddles = nullptr;
+
+		//Bluestein: padded length M, N chirp values and the forward/inverse chirp spectra (2M)
+		uint32 M = 0;
+		WGPUBuffer Chirp = nullptr;
+		WGPUBuffer ChirpSpectrum = nullptr;
+	};
+
+	FFFTPlan* GetPlan(uint32 N);
+	void ReleasePlan(FFFTPlan& Plan);
+
+	//Stockham passes Input -> Output through the ping-pong scratch, Scale applied by the last pass
+	bool EncodePow2(WGPUComputePassEncoder Pass, const FFFTPlan& Plan, WGPUBuffer Input, WGPUBuffer Output, uint32 Batch, bool bInverse, float Scale);
+	bool EncodeBluestein(WGPUComputePassEncoder Pass, const FFFTPlan& Plan, WGPUBuffer Input, WGPUBuffer Output, uint32 Batch, bool bInverse);
+	bool EncodeTranspose(WGPUComputePassEncoder Pass, WGPUBuffer Input, WGPUBuffer Output, uint32 Width, uint32 Height, uint32 Batch);
+
+	FWebGPUContext* Context = nullptr;
+
+	//Indexed 0/1/2 for radix 2/4/8
+	FWebGPUKernel StockhamKernels[3];
+	FWebGPUKernel BluesteinPremul;
+	FWebGPUKernel BluesteinPointwise;
+	FWebGPUKernel BluesteinPostmul;
+	FWebGPUKernel Transpose;
+
+	TMap<uint32, TUniquePtr<FFFTPlan>> Plans;
+
+	//Grow-only float2 scratch (capacities in bytes). Stockham ping-pong, Bluestein padded signals and
+	//2D intermediates are separate so every stage can feed the next without aliasing a binding
+	WGPUBuffer Scratch[2] = { nullptr, nullptr };
+	uint64 ScratchCapacity[2] = { 0, 0 };
+	WGPUBuffer Padded[2] = { nullptr, nullptr };
+	uint64 PaddedCapacity[2] = { 0, 0 };
+	WGPUBuffer Work2D[2] = { nullptr, nullptr };
+	uint64 Work2DCapacity[2] = { 0, 0 };
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUStreamingExecutor.h"
+
+/**
+* File backed compute job on top of FWebGPUStreamingExecutor. The input file is
+* memory mapped one chunk-sized window at a time and copied straight into the
+* mapped upload staging, results are written to the output file as each chunk
+* retires, so peak memory stays at a few chunks regardless of file size.
+*/
+class WEBGPUCOMPUTE_API FWebGPUFileJob
+{
+public:
+	//Same kernel contract as FWebGPUStreamingExecutor
+	bool Initialize(FWebGPUContext& InContext, const FString& Source, uint32 WorkgroupSize = 64, uint64 MaxChunkBytes = 0);
+	void Release();
+
+	//Input size must be a whole number of ElementSize bytes. Output has the same size.
+	bool Run(const FString& InputPath, const FString& OutputPath, uint32 ElementSize = sizeof(uint32));
+
+private:
+	FWebGPUStreamingExecutor Executor;
+};
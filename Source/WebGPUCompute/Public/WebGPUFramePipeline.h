@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "webgpu/wgpu.h"
+#include "WebGPUKernel.h"
+
+/**
+* Runs one RunShader-style kernel per frame without ever blocking on the result.
+* Each frame gets its own storage/staging slot from a ring of FramesInFlight, the
+* dispatch is submitted right away and its staging buffer is mapped asynchronously,
+* so frame N's work overlaps with reading back frame N - (FramesInFlight - 1).
+* Results surface through Tick() (non-blocking poll) one or two frames late.
+*/
+class WEBGPUCOMPUTE_API FWebGPUFramePipeline
+{
+public:
+	~FWebGPUFramePipeline();
+
+	bool Initialize(FWebGPUContext& InContext, const FString& Source, int32 InFramesInFlight = 3);
+	void Release();
+	bool IsInitialized() const { return Kernel.IsValid(); }
+
+	//Uploads and submits this frame's dispatch. Only waits if the slot being reused is still in flight.
+	bool Submit(const TArray<int32>& InData);
+
+	//Non-blocking device poll, completed slots become the latest result
+	void Tick();
+
+	//Latest completed result, returns false until the first frame arrives
+	bool GetLatestResult(TArray<int32>& OutData, int64& OutFrameIndex) const;
+
+	//Same as GetLatestResult but only true once per newly arrived frame
+	bool ConsumeNewResult(TArray<int32>& OutData, int64& OutFrameIndex);
+
+	int64 GetSubmittedFrameIndex() const { return NextFrameIndex - 1; }
+
+private:
+	enum class ESlotState : uint8
+	{
+		Idle,
+		InFlight,
+	};
+
+	struct FFrameSlot
+	{
+		FWebGPUFramePipeline* Owner = nullptr;
+		WGPUBuffer StorageBuffer = nullptr;
+		WGPUBuffer StagingBuffer = nullptr;
+		WGPUBindGroup BindGroup = nullptr;
+		uint64 Capacity = 0;
+		uint64 Size = 0;
+		int64 FrameIndex = INDEX_NONE;
+		WGPUSubmissionIndex SubmissionIndex = 0;
+		ESlotState State = ESlotState::Idle;
+	};
+
+	bool EnsureSlotCapacity(FFrameSlot& Slot, uint64 Size);
+	void ReleaseSlot(FFrameSlot& Slot);
+	void OnSlotMapped(FFrameSlot& Slot, bool bSuccess);
+
+	FWebGPUContext* Context = nullptr;
+	FWebGPUKernel Kernel;
+
+	//Sized once in Initialize, map callbacks hold raw pointers into it
+	TArray<FFrameSlot> Slots;
+
+	int64 NextFrameIndex = 0;
+
+	TArray<int32> LatestResult;
+	int64 LatestFrameIndex = INDEX_NONE;
+	bool bHasNewResult = false;
+};
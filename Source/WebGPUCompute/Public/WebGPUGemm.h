@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUKernel.h"
+
+struct FWebGPUGemmConfig
+{
+	//Output tile per workgroup and the K slice staged in shared memory per step.
+	//TileM/TileN must be multiples of ThreadTile, TileM * TileK and TileK * TileN at most MaxTileElements.
+	uint32 TileM = 64;
+	uint32 TileN = 64;
+	uint32 TileK = 16;
+
+	//A is stored K x M and/or B is stored N x K (row major)
+	bool bTransposeA = false;
+	bool bTransposeB = false;
+
+	//f16 storage for A, B and C (accumulation stays f32), needs WGPUFeatureName_ShaderF16
+	bool bFloat16 = false;
+};
+
+/**
+* Dense row-major matrix multiply C[M x N] = op(A)[M x K] * op(B)[K x N].
+* Each workgroup stages TileM x TileK and TileK x TileN slices of A and B in
+* shared memory, each invocation accumulates a ThreadTile x ThreadTile block of C
+* in registers. Tile sizes and transposes are WGSL override constants, so one
+* module serves every configuration and each instance bakes one pipeline.
+*/
+class WEBGPUCOMPUTE_API FWebGPUGemm
+{
+public:
+	~FWebGPUGemm();
+
+	bool Initialize(FWebGPUContext& InContext, const FWebGPUGemmConfig& InConfig = FWebGPUGemmConfig());
+	void Release();
+	bool IsInitialized() const { return Kernel.IsValid(); }
+
+	//A, B and C hold float (or f16 when configured) elements, C must not alias A or B
+	bool EncodeMultiply(WGPUComputePassEncoder Pass, WGPUBuffer A, WGPUBuffer B, WGPUBuffer C, uint32 M, uint32 N, uint32 K) const;
+
+	//Encodes and submits, doesn't wait or read back
+	bool Multiply(WGPUBuffer A, WGPUBuffer B, WGPUBuffer C, uint32 M, uint32 N, uint32 K) const;
+
+	const FWebGPUGemmConfig& GetConfig() const { return Config; }
+
+	//Bytes per matrix element for the current config
+	uint32 GetElementSize() const { return Config.bFloat16 ? 2 : 4; }
+
+	//Register block per invocation, fixed since function scope arrays can't be override sized
+	static constexpr uint32 ThreadTile = 4;
+	static constexpr uint32 MaxTileElements = 2048;
+
+private:
+	struct FGemmParams
+	{
+		uint32 M;
+		uint32 N;
+		uint32 K;
+		uint32 Pad;
+	};
+
+	FWebGPUContext* Context = nullptr;
+	FWebGPUKernel Kernel;
+	FWebGPUGemmConfig Config;
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUKernel.h"
+#include "WebGPUReduction.h"
+
+/**
+* Histogram of a GPU buffer into NumBins equal width bins over [MinValue, MaxValue].
+* Every workgroup counts its grid-stride slice into workgroup-private atomic bins and
+* merges the non-empty ones into the global bins with one atomicAdd each, so global
+* atomic traffic scales with bins per workgroup rather than with elements.
+* Values outside the range (and NaNs) are not counted.
+*/
+class WEBGPUCOMPUTE_API FWebGPUHistogram
+{
+public:
+	~FWebGPUHistogram();
+
+	bool Initialize(FWebGPUContext& InContext);
+	void Release();
+	bool IsInitialized() const { return Context != nullptr; }
+
+	//Clears Bins (NumBins u32 counters, Storage usage) and accumulates Count elements of Input into it.
+	//Int32/UInt32 bins are ceil((Max - Min + 1) / NumBins) integers wide.
+	bool EncodeHistogram(WGPUComputePassEncoder Pass, WGPUBuffer Input, uint32 Count, EWebGPUScalarType Type,
+		uint32 NumBins, double MinValue, double MaxValue, WGPUBuffer Bins);
+
+	//Blocking variant, only the bins are read back
+	bool Histogram(WGPUBuffer Input, uint32 Count, EWebGPUScalarType Type, uint32 NumBins, double MinValue, double MaxValue, TArray<uint32>& OutBins);
+
+	static constexpr uint32 WorkgroupSize = 256;
+	static constexpr uint32 ItemsPerThread = 16;
+
+	//Workgroup-private bins have to fit workgroup storage (16 KB minimum limit)
+	static constexpr uint32 MaxBins = 4096;
+
+private:
+	struct FHistogramParams
+	{
+		uint32 Count;
+		uint32 NumBins;
+		uint32 MinBits;
+		uint32 MaxBits;
+		float Scale;
+		uint32 Width;
+		uint32 Pad0;
+		uint32 Pad1;
+	};
+
+	struct FHistogramKernels
+	{
+		FWebGPUKernel Clear;
+		FWebGPUKernel Count;
+	};
+
+	FHistogramKernels* GetKernels(EWebGPUScalarType Type);
+
+	FWebGPUContext* Context = nullptr;
+	FHistogramKernels Kernels[3];
+
+	//Bins buffer reused by the blocking variant
+	WGPUBuffer ScratchBins = nullptr;
+};
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUKernel.h"
+
+//Single channel f32 image, either a row-major storage buffer or a texture view.
+//Input textures are bound as unfilterable r32float textures (TextureBinding usage),
+//output textures as write-only r32float storage textures (StorageBinding usage).
+struct FWebGPUImage
+{
+	WGPUBuffer Buffer = nullptr;
+	WGPUTextureView Texture = nullptr;
+
+	static FWebGPUImage FromBuffer(WGPUBuffer InBuffer)
+	{
+		FWebGPUImage Image;
+		Image.Buffer = InBuffer;
+		return Image;
+	}
+
+	static FWebGPUImage FromTexture(WGPUTextureView InTexture)
+	{
+		FWebGPUImage Image;
+		Image.Texture = InTexture;
+		return Image;
+	}
+
+	bool IsTexture() const { return Texture != nullptr; }
+	bool IsValid() const { return Buffer != nullptr || Texture != nullptr; }
+};
+
+/**
+* Image filters for height maps and masks. Borders clamp to the edge.
+* - Separable convolution: a row pass over 256 pixel tiles and a column pass over
+*   16 x 64 pixel tiles, each tile staged in shared memory with a radius wide halo.
+* - Box blur: one invocation per row / column keeps a running window sum, so the
+*   cost per pixel doesn't depend on the radius.
+* - Gaussian blur: convolution up to MaxRadius, three box blurs of matching variance beyond.
+* - Downsample pyramid: 2x2 averages, odd edges clamp.
+* Row and column passes go through an internal buffer, so Input and Output may be the same buffer.
+*/
+class WEBGPUCOMPUTE_API FWebGPUImageFilter
+{
+public:
+	~FWebGPUImageFilter();
+
+	bool Initialize(FWebGPUContext& InContext);
+	void Release();
+	bool IsInitialized() const { return Context != nullptr; }
+
+	//Odd tap counts up to 2 * MaxRadius + 1, WeightsX along rows and WeightsY along columns
+	bool EncodeSeparable(WGPUComputePassEncoder Pass, const FWebGPUImage& Input, const FWebGPUImage& Output, uint32 Width, uint32 Height,
+		const TArray<float>& WeightsX, const TArray<float>& WeightsY);
+
+	//Mean over a (2 * Radius + 1)^2 window, any radius
+	bool EncodeBoxBlur(WGPUComputePassEncoder Pass, const FWebGPUImage& Input, const FWebGPUImage& Output, uint32 Width, uint32 Height, uint32 Radius);
+
+	bool EncodeGaussianBlur(WGPUComputePassEncoder Pass, const FWebGPUImage& Input, const FWebGPUImage& Output, uint32 Width, uint32 Height, float Sigma);
+
+	//Output is ceil(Width / 2) x ceil(Height / 2)
+	bool EncodeDownsample(WGPUComputePassEncoder Pass, const FWebGPUImage& Input, WGPUBuffer Output, uint32 Width, uint32 Height);
+
+	//Levels[i] holds level i + 1 (see GetPyramidLevelSize), each level is built from the previous one
+	bool EncodePyramid(WGPUComputePassEncoder Pass, const FWebGPUImage& Input, uint32 Width, uint32 Height, const TArray<WGPUBuffer>& Levels);
+
+	//Storage buffers for NumLevels pyramid levels below Width x Height, caller releases them
+	TArray<WGPUBuffer> CreatePyramidBuffers(uint32 Width, uint32 Height, int32 NumLevels) const;
+	static void GetPyramidLevelSize(uint32 Width, uint32 Height, int32 Level, uint32& OutWidth, uint32& OutHeight);
+
+	//Normalized taps for a Gaussian of Sigma, radius ceil(3 sigma)
+	static TArray<float> MakeGaussianWeights(float Sigma);
+
+	static constexpr uint32 MaxRadius = 64;
+	static constexpr uint32 RowTile = 256;
+	static constexpr uint32 ColumnTileWidth = 16;
+	static constexpr uint32 ColumnTileHeight = 64;
+
+private:
+	enum EFilterKernel
+	{
+		ConvolveRows,
+		ConvolveColumns,
+		BoxRows,
+		BoxColumns,
+		Downsample,
+		NumFilterKernels
+	};
+
+	struct FFilterParams
+	{
+		uint32 Width;
+		uint32 Height;
+		uint32 Radius;
+		uint32 OutWidth;
+	};
+
+	struct FFilterWeights
+	{
+		TArray<float> Weights;
+		WGPUBuffer Buffer = nullptr;
+	};
+
+	//Variant 1 binds a texture at the end that varies (input for row/downsample passes, output for column passes)
+	FWebGPUKernel* GetKernel(EFilterKernel Kernel, bool bTexture);
+	WGPUBuffer GetWeightsBuffer(const TArray<float>& Weights);
+	WGPUBuffer GetScratch(int32 Index, uint64 NumPixels);
+
+	WGPUBindGroupEntry MakeEntry(uint32 Binding, const FWebGPUImage& Image) const;
+	bool EncodePass(WGPUComputePassEncoder Pass, EFilterKernel KernelType, const FWebGPUImage& Input, const FWebGPUImage& Output,
+		const FFilterParams& Params, WGPUBuffer Weights, uint32 GroupsX, uint32 GroupsY);
+
+	FWebGPUContext* Context = nullptr;
+	FWebGPUKernel Kernels[NumFilterKernels][2];
+
+	//Immutable once uploaded, so several filters can be recorded into one submit. Least recently
+	//used first, bounded so a sweep over sigmas doesn't keep a buffer per value alive.
+	TArray<FFilterWeights> WeightsCache;
+	static constexpr int32 MaxCachedWeights = 8;
+
+	//Row pass results and chained box blur ping-pong, grow-only, capacities in bytes
+	WGPUBuffer Scratch[2] = { nullptr, nullptr };
+	uint64 ScratchCapacity[2] = { 0, 0 };
+};
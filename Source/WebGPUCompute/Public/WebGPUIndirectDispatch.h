@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUKernel.h"
+
+/**
+* GPU-driven dispatch sizing. A helper kernel turns an element count that lives in
+* a GPU buffer (e.g. written by a compaction pass) into workgroup counts in an
+* indirect args buffer, so the next kernel can be dispatched without reading the
+* count back to the CPU.
+*
+* Counts above maxComputeWorkgroupsPerDimension spill into Y, consumers should
+* derive their linear index as (workgroup_id.y * num_workgroups.x + workgroup_id.x)
+* * workgroup size + local index and bounds check it against the count.
+*/
+class WEBGPUCOMPUTE_API FWebGPUIndirectDispatch
+{
+public:
+	//Size of one (x, y, z) dispatch args entry
+	static constexpr uint32 ArgsStride = 3 * sizeof(uint32);
+
+	bool Initialize(FWebGPUContext& InContext);
+	void Release();
+	bool IsInitialized() const { return CountToArgsKernel.IsValid(); }
+
+	//Storage | Indirect buffer holding NumEntries dispatch args, written by EncodeCountToArgs
+	WGPUBuffer CreateArgsBuffer(uint32 NumEntries = 1) const;
+
+	//Records the helper kernel: Args[ArgsEntry] = ceil(Counts[CountIndex] / WorkgroupSize) split over x/y.
+	//Leaves the helper pipeline bound, rebind your own pipeline before dispatching indirect.
+	bool EncodeCountToArgs(WGPUComputePassEncoder Pass, WGPUBuffer CountBuffer, uint32 CountIndex, uint32 WorkgroupSize, WGPUBuffer ArgsBuffer, uint32 ArgsEntry = 0) const;
+
+private:
+	FWebGPUContext* Context = nullptr;
+	FWebGPUKernel CountToArgsKernel;
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "webgpu/webgpu.h"
+
+class FWebGPUContext;
+
+/**
+* One compiled compute entry point with an explicit layout: storage buffers at
+* @group(0) in binding order and, if the kernel takes parameters, the context
+* uniform ring at @group(1) @binding(0) selected per dispatch by dynamic offset.
+*/
+class WEBGPUCOMPUTE_API FWebGPUKernel
+{
+public:
+	~FWebGPUKernel();
+
+	//Constants are WGSL override values baked into the pipeline
+	bool Create(FWebGPUContext& InContext, const FString& Source, const TArray<WGPUBufferBindingType>& InBindings, bool bInUsesParams, const char* EntryPoint = "main", const TArray<WGPUConstantEntry>& Constants = {});
+
+	//Explicit @group(0) entries, for kernels that bind textures next to buffers
+	bool CreateWithLayout(FWebGPUContext& InContext, const FString& Source, const TArray<WGPUBindGroupLayoutEntry>& LayoutEntries, bool bInUsesParams, const char* EntryPoint = "main", const TArray<WGPUConstantEntry>& Constants = {});
+	void Release();
+	bool IsValid() const { return Pipeline != nullptr; }
+
+	//Binds each buffer whole, in binding order. Caller releases the result.
+	WGPUBindGroup CreateBindGroup(const TArray<WGPUBuffer>& Buffers) const;
+
+	//One entry per layout binding (buffers and/or texture views)
+	WGPUBindGroup CreateBindGroup(const TArray<WGPUBindGroupEntry>& Entries) const;
+
+	//Sets pipeline and bind groups, Params (if any) are copied into the uniform ring. False (nothing
+	//recorded) when the ring is exhausted, the caller has to fail the whole operation.
+	bool Dispatch(WGPUComputePassEncoder Pass, WGPUBindGroup BindGroup, const void* Params, uint32 ParamsSize, uint32 X, uint32 Y = 1, uint32 Z = 1) const;
+	bool DispatchIndirect(WGPUComputePassEncoder Pass, WGPUBindGroup BindGroup, const void* Params, uint32 ParamsSize, WGPUBuffer ArgsBuffer, uint64 ArgsOffset) const;
+
+	template<typename T>
+	bool Dispatch(WGPUComputePassEncoder Pass, WGPUBindGroup BindGroup, const T& Params, uint32 X, uint32 Y = 1, uint32 Z = 1) const
+	{
+		return Dispatch(Pass, BindGroup, &Params, sizeof(T), X, Y, Z);
+	}
+
+	WGPUComputePipeline GetPipeline() const { return Pipeline; }
+	WGPUBindGroupLayout GetBindGroupLayout() const { return BindGroupLayout; }
+
+private:
+	bool Bind(WGPUComputePassEncoder Pass, WGPUBindGroup BindGroup, const void* Params, uint32 ParamsSize) const;
+
+	FWebGPUContext* Context = nullptr;
+	WGPUShaderModule ShaderModule = nullptr;
+	WGPUBindGroupLayout BindGroupLayout = nullptr;
+	WGPUPipelineLayout PipelineLayout = nullptr;
+	WGPUComputePipeline Pipeline = nullptr;
+	int32 NumBindings = 0;
+	bool bUsesParams = false;
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUKernel.h"
+#include "WebGPUImageFilter.h"
+#include "WebGPUNoise.generated.h"
+
+UENUM(BlueprintType)
+enum class EWebGPUNoiseType : uint8
+{
+	Gradient2D		UMETA(ToolTip = "Perlin style gradient noise, roughly [-1, 1]"),
+	Gradient3D		UMETA(ToolTip = "Gradient noise on an XY slice at OriginZ, roughly [-1, 1]"),
+	Cellular2D		UMETA(ToolTip = "Distance to the nearest jittered feature point (F1), [0, ~1.2]"),
+};
+
+struct FWebGPUNoiseSettings
+{
+	EWebGPUNoiseType Type = EWebGPUNoiseType::Gradient2D;
+	uint32 Seed = 1337;
+
+	//Lattice cells per pixel
+	float Frequency = 1.f / 64.f;
+
+	//fBm octaves (1 = plain noise), each scaled by Lacunarity in frequency and Gain in amplitude
+	int32 Octaves = 1;
+	float Lacunarity = 2.f;
+	float Gain = 0.5f;
+
+	//Domain warp offset in lattice cells, 0 disables warping
+	float WarpStrength = 0.f;
+
+	//Pixel coordinate of the first texel, tiles with adjacent origins line up seamlessly
+	float OriginX = 0.f;
+	float OriginY = 0.f;
+	float OriginZ = 0.f;
+};
+
+/**
+* Procedural noise fields written straight into a resident buffer or r32float storage texture
+* (see FWebGPUImage), one invocation per texel. Lattice hashing is integer only, so a seed
+* gives the same field on every device and in the CPU reference (SampleCPU / FillCPU), which
+* mirrors the shader op for op and only differs by float rounding.
+*/
+class WEBGPUCOMPUTE_API FWebGPUNoise
+{
+public:
+	~FWebGPUNoise();
+
+	bool Initialize(FWebGPUContext& InContext);
+	void Release();
+	bool IsInitialized() const { return Context != nullptr; }
+
+	//Fills Width x Height texels of Output (row-major f32 buffer or r32float storage texture)
+	bool EncodeFill(WGPUComputePassEncoder Pass, const FWebGPUImage& Output, uint32 Width, uint32 Height, const FWebGPUNoiseSettings& Settings);
+
+	//Blocking variant, fills a buffer and reads it back
+	bool Fill(uint32 Width, uint32 Height, const FWebGPUNoiseSettings& Settings, TArray<float>& OutData);
+
+	//CPU reference of the same field, X/Y in pixels relative to the origin
+	static float SampleCPU(const FWebGPUNoiseSettings& Settings, float X, float Y);
+	static void FillCPU(uint32 Width, uint32 Height, const FWebGPUNoiseSettings& Settings, TArray<float>& OutData);
+
+	static constexpr uint32 TileSize = 16;
+	static constexpr int32 MaxOctaves = 16;
+
+private:
+	struct FNoiseParams
+	{
+		uint32 Width;
+		uint32 Height;
+		uint32 Seed;
+		uint32 Octaves;
+		uint32 Type;
+		uint32 Pad0;
+		uint32 Pad1;
+		uint32 Pad2;
+		float Frequency;
+		float Lacunarity;
+		float Gain;
+		float Warp;
+		float Origin[4];
+	};
+
+	FWebGPUKernel* GetKernel(bool bTexture);
+
+	FWebGPUContext* Context = nullptr;
+	FWebGPUKernel Kernels[2];
+
+	//Output of the blocking variant, grow-only, capacity in bytes
+	WGPUBuffer Scratch = nullptr;
+	uint64 ScratchCapacity = 0;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUKernel.h"
+#include "WebGPUScan.h"
+
+/**
+* Stable LSD radix sort of uint32 (or 64 bit, stored lo/hi) keys held in a GPU buffer,
+* optionally carrying a uint32 payload per key. Every 4 bit digit pass is: per-tile
+* digit histogram -> FWebGPUScan over the digit-major histogram -> per-tile stable
+* local sort (four 1-bit splits in shared memory) and scatter. Passes ping-pong with
+* internal temp buffers; the pass count is even so results end up back in place.
+*/
+class WEBGPUCOMPUTE_API FWebGPURadixSort
+{
+public:
+	~FWebGPURadixSort();
+
+	bool Initialize(FWebGPUContext& InContext);
+	void Release();
+	bool IsInitialized() const { return Context != nullptr; }
+
+	//Sorts Count keys in place, ascending. Payload may be nullptr, otherwise it is permuted with the keys.
+	bool EncodeSort(WGPUComputePassEncoder Pass, WGPUBuffer Keys, WGPUBuffer Payload, uint32 Count, bool b64BitKeys = false);
+
+	//Encodes and submits, doesn't wait or read back
+	bool Sort(WGPUBuffer Keys, WGPUBuffer Payload, uint32 Count, bool b64BitKeys = false);
+
+	//Same digit order on the cpu, for validating GPU results. Payload may be nullptr.
+	static void SortOnCPU(TArray<uint32>& Keys, TArray<uint32>* Payload);
+	static void SortOnCPU(TArray<uint64>& Keys, TArray<uint32>* Payload);
+
+	static constexpr uint32 RadixBits = 4;
+	static constexpr uint32 NumDigits = 1 << RadixBits;
+	static constexpr uint32 WorkgroupSize = 256;
+	static constexpr uint32 TileSize = WorkgroupSize * 4;
+
+private:
+	struct FSortParams
+	{
+		uint32 Count;
+		uint32 Shift;
+		uint32 Word;
+		uint32 NumTiles;
+	};
+
+	bool EnsureKernels(bool b64BitKeys, bool bPayload);
+
+	FWebGPUContext* Context = nullptr;
+	FWebGPUScan Scan;
+
+	//[64 bit keys]
+	FWebGPUKernel HistogramKernels[2];
+
+	//[64 bit keys][payload]
+	FWebGPUKernel ScatterKernels[2][2];
+
+	WGPUBuffer TempKeys = nullptr;
+	WGPUBuffer TempPayload = nullptr;
+	WGPUBuffer Histogram = nullptr;
+	WGPUBuffer DigitOffsets = nullptr;
+	uint64 TempKeysCapacity = 0;
+	uint64 TempPayloadCapacity = 0;
+	uint64 HistogramCapacity = 0;
+	uint64 DigitOffsetsCapacity = 0;
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUKernel.h"
+#include "WebGPUReduction.generated.h"
+
+UENUM(BlueprintType)
+enum class EWebGPUReduceOp : uint8
+{
+	Sum,
+	Min,
+	Max,
+	ArgMax		UMETA(ToolTip = "Largest value and the lowest index holding it"),
+};
+
+UENUM(BlueprintType)
+enum class EWebGPUScalarType : uint8
+{
+	Int32,
+	UInt32,
+	Float,
+};
+
+/**
+* Built-in parallel reductions over a GPU buffer. Each pass has every workgroup fold a
+* grid-stride slice into one partial (shared memory tree, or subgroup ops plus one
+* slot per subgroup when the device has WGPUNativeFeature_Subgroup), passes repeat
+* over the partials until one is left. Only the final 4 bytes (8 for ArgMax) are read back.
+*/
+class WEBGPUCOMPUTE_API FWebGPUReduction
+{
+public:
+	~FWebGPUReduction();
+
+	bool Initialize(FWebGPUContext& InContext);
+	void Release();
+	bool IsInitialized() const { return Context != nullptr; }
+
+	//Records all passes into Pass. The result lands in GetResultBuffer() at offset 0 as (value bits, index).
+	bool EncodeReduce(WGPUComputePassEncoder Pass, WGPUBuffer Input, uint32 Count, EWebGPUReduceOp Op, EWebGPUScalarType Type);
+
+	//Blocking variant, OutValue receives the 4 byte result in Type's representation
+	bool Reduce(WGPUBuffer Input, uint32 Count, EWebGPUReduceOp Op, EWebGPUScalarType Type, void* OutValue, uint32* OutIndex = nullptr);
+
+	//Valid after EncodeReduce, until the next one
+	WGPUBuffer GetResultBuffer() const { return ResultBuffer; }
+
+	static constexpr uint32 WorkgroupSize = 256;
+	static constexpr uint32 ItemsPerThread = 4;
+
+	//Upper bound on partials per pass, so the second pass is always a single workgroup
+	static constexpr uint32 MaxPartials = WorkgroupSize * ItemsPerThread;
+
+private:
+	struct FReduceParams
+	{
+		uint32 Count;
+		uint32 FirstPass;
+		uint32 Pad0;
+		uint32 Pad1;
+	};
+
+	//Lazily compiles the (op, type, path) variant, falls back to the tree path if subgroups don't compile
+	FWebGPUKernel* GetKernel(EWebGPUReduceOp Op, EWebGPUScalarType Type);
+
+	FWebGPUContext* Context = nullptr;
+
+	static constexpr int32 NumOps = 4;
+	static constexpr int32 NumTypes = 3;
+	FWebGPUKernel Kernels[NumOps][NumTypes][2];
+
+	//Ping-pong partials, (value bits, index) per workgroup
+	WGPUBuffer ScratchBuffers[2] = { nullptr, nullptr };
+	WGPUBuffer ResultBuffer = nullptr;
+
+	bool bUseSubgroups = false;
+};
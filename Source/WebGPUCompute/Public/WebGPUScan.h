@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WebGPUKernel.h"
+#include "WebGPUReduction.h"
+
+/**
+* Reduce-then-scan prefix sum over a GPU buffer. Each workgroup owns a tile of
+* TileSize elements: one pass writes per-tile totals, the totals are scanned
+* recursively (a level per factor of TileSize, so three levels cover ~1e9 elements),
+* then a last pass scans every tile in shared memory and adds its tile offset.
+* Tile dispatches spill into Y above maxComputeWorkgroupsPerDimension.
+*/
+class WEBGPUCOMPUTE_API FWebGPUScan
+{
+public:
+	~FWebGPUScan();
+
+	bool Initialize(FWebGPUContext& InContext);
+	void Release();
+	bool IsInitialized() const { return Context != nullptr; }
+
+	//Records the scan of Count elements of Input into Output (must be different buffers).
+	//Int32/UInt32 scans wrap on overflow, Float scans are not bitwise equal to a serial sum.
+	bool EncodeScan(WGPUComputePassEncoder Pass, WGPUBuffer Input, WGPUBuffer Output, uint32 Count, bool bInclusive, EWebGPUScalarType Type = EWebGPUScalarType::UInt32);
+
+	//Encodes and submits, doesn't wait or read back
+	bool Scan(WGPUBuffer Input, WGPUBuffer Output, uint32 Count, bool bInclusive, EWebGPUScalarType Type = EWebGPUScalarType::UInt32);
+
+	static constexpr uint32 WorkgroupSize = 256;
+	static constexpr uint32 ItemsPerThread = 4;
+	static constexpr uint32 TileSize = WorkgroupSize * ItemsPerThread;
+
+private:
+	struct FScanParams
+	{
+		uint32 Count;
+		uint32 Inclusive;
+		uint32 HasOffsets;
+		uint32 Pad;
+	};
+
+	struct FScanLevel
+	{
+		//Per-tile totals of the level above, and their exclusive scan
+		WGPUBuffer TileSums = nullptr;
+		WGPUBuffer TileOffsets = nullptr;
+		uint32 Capacity = 0;
+	};
+
+	struct FScanKernels
+	{
+		FWebGPUKernel Reduce;
+		FWebGPUKernel ScanTiles;
+	};
+
+	FScanKernels* GetKernels(EWebGPUScalarType Type);
+	FScanLevel& GetLevel(int32 Level, uint32 NumTiles);
+	bool EncodeLevel(WGPUComputePassEncoder Pass, FScanKernels& Kernels, WGPUBuffer Input, WGPUBuffer Output, uint32 Count, bool bInclusive, int32 Level);
+
+	FWebGPUContext* Context = nullptr;
+	FScanKernels Kernels[3];
+	TArray<FScanLevel> Levels;
+
+	//Bound as the offsets of single-tile scans, never read
+	WGPUBuffer DummyOffsets = nullptr;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "webgpu/wgpu.h"
+#include "WebGPUKernel.h"
+
+/**
+* Runs an in-place kernel over inputs larger than one buffer or binding allows.
+* The input is cut into chunks sized from the device limits and pushed through two
+* rotating slots (upload staging, storage, readback staging), so chunk i+1 is being
+* filled while chunk i computes and chunk i-1 is read back. Sizes are 64 bit throughout.
+*
+* Kernel contract: @group(0) @binding(0) var<storage, read_write> data: array<u32>,
+* @group(1) @binding(0) var<uniform> chunk: struct { count: u32, first_lo: u32, first_hi: u32 }
+* holding the element count of this chunk and the global index of its first element.
+* Dispatches spill into Y like FWebGPUIndirectDispatch: index =
+* (workgroup_id.y * num_workgroups.x + workgroup_id.x) * WorkgroupSize + local_invocation_index.
+*/
+class WEBGPUCOMPUTE_API FWebGPUStreamingExecutor
+{
+public:
+	//Fill Dst with Size input bytes starting at byte Offset of the whole input
+	typedef TFunctionRef<void(uint64 Offset, void* Dst, uint64 Size)> FReadChunk;
+
+	//Consume Size output bytes that belong at byte Offset of the whole output
+	typedef TFunctionRef<void(uint64 Offset, const void* Src, uint64 Size)> FWriteChunk;
+
+	~FWebGPUStreamingExecutor();
+
+	//MaxChunkBytes of 0 picks a default, either way it is clamped to the device limits
+	bool Initialize(FWebGPUContext& InContext, const FString& Source, uint32 InWorkgroupSize = 64, uint64 MaxChunkBytes = 0);
+	void Release();
+	bool IsInitialized() const { return Kernel.IsValid(); }
+
+	//Streams TotalBytes through the kernel. ElementSize must be a multiple of 4 and divide TotalBytes.
+	bool Run(uint64 TotalBytes, uint32 ElementSize, FReadChunk Read, FWriteChunk Write);
+
+	uint64 GetChunkBytes() const { return ChunkBytes; }
+
+	//Default chunk when the caller doesn't ask for one, large enough to hide submit overhead
+	static constexpr uint64 DefaultChunkBytes = 64ull << 20;
+
+private:
+	struct FChunkParams
+	{
+		uint32 Count;
+		uint32 FirstLo;
+		uint32 FirstHi;
+		uint32 Pad;
+	};
+
+	struct FStreamSlot
+	{
+		WGPUBuffer UploadBuffer = nullptr;
+		WGPUBuffer StorageBuffer = nullptr;
+		WGPUBuffer ReadbackBuffer = nullptr;
+		WGPUBindGroup BindGroup = nullptr;
+
+		uint64 Offset = 0;
+		uint64 Size = 0;
+		WGPUSubmissionIndex SubmissionIndex = 0;
+		bool bPending = false;
+		bool bUploadMapped = false;
+		bool bReadbackMapped = false;
+		bool bMapFailed = false;
+		bool bDispatchFailed = false;
+	};
+
+	//Blocks until the slot's previous chunk has landed, hands it to Write and readies the slot for reuse
+	bool RetireSlot(FStreamSlot& Slot, FWriteChunk& Write);
+	bool SubmitSlot(FStreamSlot& Slot, uint64 Offset, uint64 Size, uint32 ElementSize, FReadChunk& Read);
+
+	FWebGPUContext* Context = nullptr;
+	FWebGPUKernel Kernel;
+	FStreamSlot Slots[2];
+
+	uint64 ChunkBytes = 0;
+	uint32 WorkgroupSize = 64;
+};
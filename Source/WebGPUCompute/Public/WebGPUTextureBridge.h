@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PixelFormat.h"
+#include "webgpu/webgpu.h"
+
+class FWebGPUContext;
+class UTexture2D;
+class UTextureRenderTarget2D;
+
+//2D wgpu texture with a default view, sampled + storage (where the format allows) + copy usage
+struct WEBGPUCOMPUTE_API FWebGPUTexture
+{
+	WGPUTexture Texture = nullptr;
+	WGPUTextureView View = nullptr;
+	uint32 Width = 0;
+	uint32 Height = 0;
+	WGPUTextureFormat Format = WGPUTextureFormat_Undefined;
+
+	bool IsValid() const { return Texture != nullptr; }
+	void Release();
+};
+
+/**
+* Moves pixels between Unreal textures and wgpu textures without per-pixel conversion.
+* Pixel formats map 1:1 (see ToWGPUFormat), unsupported or compressed formats are rejected.
+* Uploads are a single queue write from the mip / render target pixels. Readbacks copy the
+* texture into a buffer with 256 byte aligned rows, map it once and hand that block with the
+* aligned pitch straight to UpdateTextureRegions / RHI UpdateTexture2D, so rows are never repacked.
+*/
+class WEBGPUCOMPUTE_API FWebGPUTextureBridge
+{
+public:
+	explicit FWebGPUTextureBridge(FWebGPUContext& InContext);
+
+	bool CreateTexture(uint32 Width, uint32 Height, WGPUTextureFormat Format, FWebGPUTexture& OutTexture, const char* Label = "bridge_texture") const;
+
+	//Needs CPU resident, uncompressed mip data (e.g. transient textures or VectorDisplacementMap/HDR compression settings)
+	bool UploadTexture2D(UTexture2D* Texture, FWebGPUTexture& OutTexture, int32 MipIndex = 0) const;
+
+	//Reads the render target back from the RHI (flushes rendering) into a texture of the matching format
+	bool UploadRenderTarget(UTextureRenderTarget2D* RenderTarget, FWebGPUTexture& OutTexture) const;
+
+	//Render target / texture must match the wgpu texture's size and mapped pixel format
+	bool ReadbackToRenderTarget(const FWebGPUTexture& Texture, UTextureRenderTarget2D* RenderTarget) const;
+	bool ReadbackToTexture2D(const FWebGPUTexture& Texture, UTexture2D* Texture2D) const;
+
+	//Blocking readback of mip 0, rows are OutRowPitch bytes apart
+	bool ReadbackPixels(const FWebGPUTexture& Texture, TArray<uint8>& OutData, uint32& OutRowPitch) const;
+
+	static WGPUTextureFormat ToWGPUFormat(EPixelFormat Format);
+	static EPixelFormat ToPixelFormat(WGPUTextureFormat Format);
+	static uint32 GetBytesPerPixel(WGPUTextureFormat Format);
+	static WGPUTextureSampleType GetSampleType(WGPUTextureFormat Format);
+
+	//bytesPerRow of texture <-> buffer copies has to be a multiple of 256
+	static constexpr uint32 RowPitchAlignment = 256;
+	static uint32 GetAlignedRowPitch(uint32 Width, WGPUTextureFormat Format);
+
+	//Write-only storage binding support, BGRA8 needs WGPUFeatureName_BGRA8UnormStorage
+	bool SupportsStorage(WGPUTextureFormat Format) const;
+
+private:
+	bool WritePixels(const void* Data, uint32 Width, uint32 Height, uint32 RowPitch, WGPUTextureFormat Format, FWebGPUTexture& OutTexture) const;
+
+	FWebGPUContext& Context;
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "webgpu/webgpu.h"
+
+class FWebGPUContext;
+
+/**
+* One large uniform buffer split into per-frame slices. Blocks are bump allocated
+* out of the current slice at 256 byte alignment and a slice is only recycled
+* FramesInFlight frames later. All blocks share a single bind group and are
+* selected with a dynamic offset at SetBindGroup time.
+* A slice that fills up mid frame moves on to the next one early, as long as the
+* work recorded since the last submit doesn't already span FramesInFlight - 1
+* slices; past that Allocate fails instead of overwriting blocks still in use.
+*/
+class WEBGPUCOMPUTE_API FWebGPUUniformRing
+{
+public:
+	//Largest minUniformBufferOffsetAlignment any adapter reports, so always valid
+	static constexpr uint32 Alignment = 256;
+
+	~FWebGPUUniformRing();
+
+	//BindingSize is the window each dynamic offset exposes, i.e. max uniform struct size in WGSL
+	bool Initialize(FWebGPUContext& InContext, uint32 InBytesPerFrame = 1 << 20, uint32 InFramesInFlight = 3, uint32 InBindingSize = Alignment);
+	void Release();
+	bool IsInitialized() const { return Buffer != nullptr; }
+
+	//Moves to the next slice, call once per frame. Flushes anything still pending in the old one.
+	void BeginFrame();
+
+	//Copies Data into the current slice. OutDynamicOffset is what gets passed to SetBindGroup.
+	bool Allocate(const void* Data, uint32 Size, uint32& OutDynamicOffset);
+
+	//How many more Size byte blocks Allocate accepts before the work has to be submitted
+	uint64 GetFreeBlocks(uint32 Size) const;
+
+	//Uploads all blocks allocated since the last flush in one queue write, call before submit
+	void Flush();
+
+	//Call after the submit that consumed the flushed blocks, resets the mid frame wrap budget
+	void MarkSubmitted();
+
+	WGPUBindGroupLayout GetBindGroupLayout() const { return BindGroupLayout; }
+	WGPUBindGroup GetBindGroup() const { return BindGroup; }
+	uint32 GetBindingSize() const { return BindingSize; }
+	uint64 GetFrameIndex() const { return FrameIndex; }
+
+private:
+	uint64 GetSliceBase() const { return (FrameIndex % FramesInFlight) * (uint64)BytesPerFrame; }
+
+	FWebGPUContext* Context = nullptr;
+	WGPUBuffer Buffer = nullptr;
+	WGPUBindGroupLayout BindGroupLayout = nullptr;
+	WGPUBindGroup BindGroup = nullptr;
+
+	//CPU copy of the current slice so all of a frame's blocks go up in one write
+	TArray<uint8> Shadow;
+
+	uint32 BytesPerFrame = 0;
+	uint32 FramesInFlight = 0;
+	uint32 BindingSize = 0;
+	uint64 FrameIndex = 0;
+
+	//Slices moved through mid frame since the last MarkSubmitted / BeginFrame
+	uint32 WrapsSinceSubmit = 0;
+
+	//Bump pointer and already uploaded watermark, both relative to the slice base
+	uint32 Head = 0;
+	uint32 FlushedHead = 0;
+};
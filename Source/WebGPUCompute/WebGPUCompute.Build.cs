@@ -59,6 +59,8 @@ public class WebGPUCompute : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
+				"RHI",
+				"RenderCore",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);